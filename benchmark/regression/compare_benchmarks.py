@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+
+import argparse
+import json
+import sys
+
+TIME_UNITS = {'ns': 1e-9, 'us': 1e-6, 'ms': 1e-3, 's': 1.0}
+
+
+def load_results(path):
+    with open(path) as f:
+        return json.load(f)
+
+
+def merge_results(paths):
+    merged = None
+    for path in paths:
+        data = load_results(path)
+        if merged is None:
+            merged = data
+        else:
+            merged['benchmarks'].extend(data['benchmarks'])
+    return merged
+
+
+def throughput(run):
+    # higher is better for every metric
+    if 'bytes_per_second' in run:
+        return run['bytes_per_second'], 'B/s'
+    if 'items_per_second' in run:
+        return run['items_per_second'], 'items/s'
+    seconds = run['cpu_time'] * TIME_UNITS[run.get('time_unit', 'ns')]
+    return 1.0 / seconds, 'iter/s'
+
+
+def collect(data):
+    # Prefer the median of repetitions, and fall back to the mean of the
+    # individual runs, if the results don't contain aggregates
+    medians = {}
+    runs = {}
+    failed = set()
+    for run in data['benchmarks']:
+        name = run.get('run_name', run['name'])
+        if run.get('error_occurred'):
+            failed.add(name)
+            continue
+        if run.get('run_type') == 'aggregate':
+            if run.get('aggregate_name') == 'median':
+                medians[name] = throughput(run)
+            continue
+        runs.setdefault(name, []).append(throughput(run))
+
+    results = {}
+    for name, values in runs.items():
+        unit = values[0][1]
+        results[name] = (sum(v for v, _ in values) / len(values), unit)
+    results.update(medians)
+    for name in failed:
+        results.pop(name, None)
+    return results, failed
+
+
+def convert_throughput(value, unit):
+    for prefix in ('', 'K', 'M', 'G'):
+        if value < 1000:
+            break
+        value /= 1000
+    return f'{value:.2f} {prefix}{unit}'
+
+
+def compare(baseline, current, threshold):
+    base, base_failed = collect(baseline)
+    cur, cur_failed = collect(current)
+
+    regressions = []
+    width = max([len(n) for n in list(base) + list(cur)] + [9])
+    print(f'{"Benchmark":<{width}}  {"Baseline":>14}  {"Current":>14}  '
+          f'{"Change":>8}')
+    for name in sorted(set(base) | set(cur)):
+        if name not in cur:
+            status = 'FAILED' if name in cur_failed else 'missing'
+            print(f'{name:<{width}}  {"":>14}  {"":>14}  {status:>8}')
+            if name in cur_failed:
+                regressions.append(name)
+            continue
+        if name not in base:
+            print(f'{name:<{width}}  {"":>14}  '
+                  f'{convert_throughput(*cur[name]):>14}  {"new":>8}')
+            continue
+
+        (b, unit), (c, _) = base[name], cur[name]
+        change = (c - b) / b * 100
+        mark = ''
+        if change < -threshold:
+            mark = '  REGRESSION'
+            regressions.append(name)
+        elif change > threshold:
+            mark = '  improved'
+        print(f'{name:<{width}}  {convert_throughput(b, unit):>14}  '
+              f'{convert_throughput(c, unit):>14}  {change:>+7.1f}%{mark}')
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare Google Benchmark JSON results against a baseline, '
+                    'and fail if throughput regressed')
+    parser.add_argument('baseline', help='baseline results (JSON)')
+    parser.add_argument('current', nargs='+',
+                        help='current results (JSON), merged if multiple')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='allowed throughput decrease, in percent '
+                             '(default: 5)')
+    parser.add_argument('--update', action='store_true',
+                        help='write the current results into the baseline, '
+                             'instead of comparing')
+    args = parser.parse_args()
+
+    current = merge_results(args.current)
+    if args.update:
+        with open(args.baseline, 'w') as f:
+            json.dump(current, f, indent=2)
+        print(f'Wrote {len(current["benchmarks"])} results into {args.baseline}')
+        return 0
+
+    regressions = compare(load_results(args.baseline), current, args.threshold)
+    if regressions:
+        print(f'\n{len(regressions)} benchmark(s) regressed by more than '
+              f'{args.threshold}%:')
+        for name in regressions:
+            print(f'  {name}')
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,62 @@
+#!/usr/bin/env bash
+# Runs the runtime benchmarks, and compares their throughput against a
+# stored baseline with compare_benchmarks.py.
+#
+# Usage: run-regression.sh <build-dir> <baseline.json> [--update] [args...]
+#
+# <build-dir> is a build directory with SCN_BENCHMARKS enabled, preferably
+# a Release build. With --update, the baseline is (re)written from this run,
+# instead of being compared against. Other arguments are passed to
+# compare_benchmarks.py, e.g. --threshold 10.
+#
+# Environment:
+#   BENCHMARKS      benchmark executables to run
+#                   (default: bench-int bench-float bench-word bench-tuple
+#                   bench-other bench-corpus)
+#   REPETITIONS     repetitions of every benchmark (default: 5)
+#   FILTER          --benchmark_filter regex (default: all)
+#   SCN_BENCHMARK_CORPUS_DIR
+#                   where input corpora are stored, so that runs on
+#                   different commits and machines read the same data
+#                   (default: <baseline.json dir>/corpus)
+
+set -euo pipefail
+
+if [ $# -lt 2 ]; then
+  sed -n '2,21p' "$0" | sed 's/^# \{0,1\}//'
+  exit 2
+fi
+
+script_dir=$(cd "$(dirname "$0")" && pwd)
+build_dir=$1
+baseline=$2
+shift 2
+
+benchmarks=${BENCHMARKS:-bench-int bench-float bench-word bench-tuple bench-other bench-corpus}
+repetitions=${REPETITIONS:-5}
+filter=${FILTER:-.}
+
+export SCN_BENCHMARK_CORPUS_DIR=${SCN_BENCHMARK_CORPUS_DIR:-"$(dirname "$baseline")/corpus"}
+mkdir -p "$SCN_BENCHMARK_CORPUS_DIR"
+
+out_dir=$(mktemp -d)
+trap 'rm -rf "$out_dir"' EXIT
+
+results=()
+for bench in $benchmarks; do
+  exe=$(find "$build_dir/benchmark/runtime" -type f -name "$bench" | head -n 1)
+  if [ -z "$exe" ]; then
+    echo "$bench not found in $build_dir" >&2
+    exit 2
+  fi
+
+  echo "Running $bench" >&2
+  "$exe" --benchmark_filter="$filter" \
+    --benchmark_repetitions="$repetitions" \
+    --benchmark_report_aggregates_only=true \
+    --benchmark_out="$out_dir/$bench.json" \
+    --benchmark_out_format=json >/dev/null
+  results+=("$out_dir/$bench.json")
+done
+
+python3 "$script_dir/compare_benchmarks.py" "$@" "$baseline" "${results[@]}"
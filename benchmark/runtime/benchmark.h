@@ -23,14 +23,25 @@ SCN_GCC_IGNORE("-Wredundant-decls")
 
 #include <benchmark/benchmark.h>
 
-#include <random>
+#include <cstdint>
+#include <cstdlib>
 
-inline std::mt19937_64& get_rng()
+// Seed for all generated benchmark data, so that runs on different commits
+// see the same input.
+// Can be overridden with the environment variable SCN_BENCHMARK_SEED.
+inline std::uint64_t get_benchmark_seed()
 {
-    static std::random_device rd;
-    static std::seed_seq seed{rd(), rd(), rd(), rd(), rd(), rd(), rd(), rd()};
-    static std::mt19937_64 rng(seed);
-    return rng;
+    SCN_MSVC_PUSH
+    SCN_MSVC_IGNORE(4996)
+    static const std::uint64_t seed = [] {
+        const auto env = std::getenv("SCN_BENCHMARK_SEED");
+        if (env && *env) {
+            return static_cast<std::uint64_t>(std::strtoull(env, nullptr, 0));
+        }
+        return static_cast<std::uint64_t>(0x5c4e1b2020u);
+    }();
+    SCN_MSVC_POP
+    return seed;
 }
 
 SCN_GCC_POP
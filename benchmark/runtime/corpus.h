@@ -0,0 +1,301 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_BENCHMARK_CORPUS_H
+#define SCN_BENCHMARK_CORPUS_H
+
+#include "benchmark.h"
+
+#include <cstdio>
+#include <random>
+#include <string>
+
+#define CORPUS_DATA_N (static_cast<size_t>(2 << 12))
+
+// Deterministic input corpora with realistic value distributions.
+//
+// Every corpus has its own engine, seeded from get_benchmark_seed() and the
+// name of the corpus, so that the data doesn't depend on which benchmarks
+// are run, or in which order.
+// The data generators of the other benchmarks use make_corpus_rng() and
+// corpus_uniform() the same way.
+// The standard distributions are implementation-defined, so
+// corpus_uniform() is used instead: the data is the same on every
+// standard library.
+//
+// If the environment variable SCN_BENCHMARK_CORPUS_DIR is set, corpora are
+// read from <dir>/<name>.txt instead, and generated into it if the file
+// doesn't exist yet.
+
+inline std::mt19937_64 make_corpus_rng(const char* name)
+{
+    // FNV-1a
+    std::uint64_t h = 0xcbf29ce484222325u;
+    for (; *name; ++name) {
+        h ^= static_cast<unsigned char>(*name);
+        h *= 0x100000001b3u;
+    }
+    return std::mt19937_64{get_benchmark_seed() ^ h};
+}
+
+// Uniform integer in [lo, hi]
+inline std::uint64_t corpus_uniform(std::mt19937_64& rng,
+                                    std::uint64_t lo,
+                                    std::uint64_t hi)
+{
+    const auto range = hi - lo;
+    if (range == ~std::uint64_t{0}) {
+        return rng();
+    }
+    return lo + rng() % (range + 1);
+}
+
+// Uniform floating-point value in [lo, hi)
+inline double corpus_uniform_real(std::mt19937_64& rng, double lo, double hi)
+{
+    // 53 random bits, scaled to [0, 1)
+    const auto x =
+        static_cast<double>(rng() >> 11) * (1.0 / 9007199254740992.0);
+    return lo + x * (hi - lo);
+}
+
+inline void append_digits(std::mt19937_64& rng, std::string& out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        out.push_back(static_cast<char>('0' + corpus_uniform(rng, 0, 9)));
+    }
+}
+
+inline void append_utf8(std::string& out, std::uint32_t cp)
+{
+    if (cp < 0x80) {
+        out.push_back(static_cast<char>(cp));
+    }
+    else if (cp < 0x800) {
+        out.push_back(static_cast<char>(0xc0 | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+    }
+    else if (cp < 0x10000) {
+        out.push_back(static_cast<char>(0xe0 | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+    }
+    else {
+        out.push_back(static_cast<char>(0xf0 | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+    }
+}
+
+// `n` non-negative integers of 1 to 3 digits, like counts and indices
+inline std::string generate_short_ints(std::mt19937_64& rng, size_t n)
+{
+    std::string ret;
+    for (size_t i = 0; i < n; ++i) {
+        ret.append(std::to_string(corpus_uniform(rng, 0, 999)));
+        ret.push_back(' ');
+    }
+    return ret;
+}
+
+// `n` integers uniformly distributed over the range of `long long`,
+// so nearly all of them are 18 or 19 digits long, half of them negative
+inline std::string generate_long_ints(std::mt19937_64& rng, size_t n)
+{
+    std::string ret;
+    for (size_t i = 0; i < n; ++i) {
+        ret.append(std::to_string(static_cast<long long>(rng())));
+        ret.push_back(' ');
+    }
+    return ret;
+}
+
+// `n` integers fitting in an `int`, with the number of digits uniformly
+// distributed from 1 to 9, and a random sign
+inline std::string generate_mixed_sign_ints(std::mt19937_64& rng, size_t n)
+{
+    std::string ret;
+    for (size_t i = 0; i < n; ++i) {
+        if (corpus_uniform(rng, 0, 1) != 0) {
+            ret.push_back('-');
+        }
+        const auto digits = static_cast<size_t>(corpus_uniform(rng, 1, 9));
+        ret.push_back(static_cast<char>('0' + corpus_uniform(rng, 1, 9)));
+        append_digits(rng, ret, digits - 1);
+        ret.push_back(' ');
+    }
+    return ret;
+}
+
+// `n` doubles in scientific notation, with 1 to 17 significant digits,
+// and an exponent between -300 and 300, e.g. "-4.2071e-132"
+inline std::string generate_scientific_floats(std::mt19937_64& rng, size_t n)
+{
+    std::string ret;
+    for (size_t i = 0; i < n; ++i) {
+        if (corpus_uniform(rng, 0, 1) != 0) {
+            ret.push_back('-');
+        }
+        ret.push_back(static_cast<char>('0' + corpus_uniform(rng, 1, 9)));
+        const auto digits = static_cast<size_t>(corpus_uniform(rng, 0, 16));
+        if (digits != 0) {
+            ret.push_back('.');
+            append_digits(rng, ret, digits);
+        }
+        ret.push_back('e');
+        const auto exp = static_cast<int>(corpus_uniform(rng, 0, 600)) - 300;
+        ret.append(std::to_string(exp));
+        ret.push_back(' ');
+    }
+    return ret;
+}
+
+// `n` words of 1 to 10 code points, separated by a single space.
+// Roughly half of the words are ASCII, the rest are Latin, Greek, Cyrillic,
+// CJK, or contain emoji, so all UTF-8 sequence lengths are present
+inline std::string generate_utf8_words(std::mt19937_64& rng, size_t n)
+{
+    struct block {
+        std::uint32_t first, last;
+    };
+    static const block blocks[] = {
+        {0x61, 0x7a},        // a-z
+        {0xe0, 0xff},        // Latin-1 lowercase
+        {0x3b1, 0x3c9},      // Greek lowercase
+        {0x430, 0x44f},      // Cyrillic lowercase
+        {0x4e00, 0x9fff},    // CJK unified ideographs
+        {0x1f600, 0x1f64f},  // emoticons
+    };
+    const auto block_count = sizeof(blocks) / sizeof(blocks[0]);
+
+    std::string ret;
+    for (size_t i = 0; i < n; ++i) {
+        const auto ascii = corpus_uniform(rng, 0, 1) == 0;
+        const auto& b =
+            ascii ? blocks[0] : blocks[corpus_uniform(rng, 1, block_count - 1)];
+        const auto len = corpus_uniform(rng, 1, 10);
+        for (std::uint64_t c = 0; c < len; ++c) {
+            append_utf8(ret, static_cast<std::uint32_t>(
+                                 corpus_uniform(rng, b.first, b.last)));
+        }
+        ret.push_back(' ');
+    }
+    return ret;
+}
+
+// `n` lines of "id,name,price,quantity", e.g. "1041,Widget Pro,129.99,3"
+inline std::string generate_csv_lines(std::mt19937_64& rng, size_t n)
+{
+    static const char* const names[] = {
+        "Widget", "Gadget",  "Doohickey",   "Sprocket",
+        "Gizmo",  "Whatsit", "Thingamajig", "Contraption"};
+    static const char* const suffixes[] = {"", " Pro", " Mini", " XL",
+                                           " Deluxe"};
+    const auto name_count = sizeof(names) / sizeof(names[0]);
+    const auto suffix_count = sizeof(suffixes) / sizeof(suffixes[0]);
+
+    std::string ret;
+    for (size_t i = 0; i < n; ++i) {
+        ret.append(std::to_string(1000 + i));
+        ret.push_back(',');
+        ret.append(names[corpus_uniform(rng, 0, name_count - 1)]);
+        ret.append(suffixes[corpus_uniform(rng, 0, suffix_count - 1)]);
+        ret.push_back(',');
+        ret.append(std::to_string(corpus_uniform(rng, 0, 9999)));
+        ret.push_back('.');
+        append_digits(rng, ret, 2);
+        ret.push_back(',');
+        ret.append(std::to_string(corpus_uniform(rng, 1, 100)));
+        ret.push_back('\n');
+    }
+    return ret;
+}
+
+inline bool read_corpus_file(const std::string& path, std::string& out)
+{
+    auto f = std::fopen(path.c_str(), "rb");
+    if (!f) {
+        return false;
+    }
+    char buf[4096];
+    size_t n;
+    while ((n = std::fread(buf, 1, sizeof(buf), f)) != 0) {
+        out.append(buf, n);
+    }
+    const auto ok = std::ferror(f) == 0;
+    std::fclose(f);
+    return ok;
+}
+
+inline void write_corpus_file(const std::string& path, const std::string& data)
+{
+    auto f = std::fopen(path.c_str(), "wb");
+    if (!f) {
+        return;
+    }
+    std::fwrite(data.data(), 1, data.size(), f);
+    std::fclose(f);
+}
+
+// Returns the corpus `name`, read from SCN_BENCHMARK_CORPUS_DIR, or
+// generated with `gen(rng, n)`
+template <typename Generator>
+std::string load_corpus(const char* name,
+                        Generator gen,
+                        size_t n = CORPUS_DATA_N)
+{
+    std::string ret;
+
+    SCN_MSVC_PUSH
+    SCN_MSVC_IGNORE(4996)
+    const auto dir = std::getenv("SCN_BENCHMARK_CORPUS_DIR");
+    SCN_MSVC_POP
+    std::string path{};
+    if (dir && *dir) {
+        path = std::string{dir} + "/" + name + ".txt";
+        if (read_corpus_file(path, ret)) {
+            return ret;
+        }
+        ret.clear();
+    }
+
+    auto rng = make_corpus_rng(name);
+    ret = gen(rng, n);
+    if (!path.empty()) {
+        write_corpus_file(path, ret);
+    }
+    return ret;
+}
+
+// Defines corpus_<name>(), returning the corpus, loaded once, so that every
+// benchmark using it sees the same data without regenerating it
+#define SCN_BENCHMARK_CORPUS(name, gen)                            \
+    inline const std::string& corpus_##name()                      \
+    {                                                              \
+        static const std::string data = load_corpus(#name, gen);   \
+        return data;                                               \
+    }
+
+SCN_BENCHMARK_CORPUS(short_ints, generate_short_ints)
+SCN_BENCHMARK_CORPUS(long_ints, generate_long_ints)
+SCN_BENCHMARK_CORPUS(mixed_sign_ints, generate_mixed_sign_ints)
+SCN_BENCHMARK_CORPUS(scientific_floats, generate_scientific_floats)
+SCN_BENCHMARK_CORPUS(utf8_words, generate_utf8_words)
+SCN_BENCHMARK_CORPUS(csv_lines, generate_csv_lines)
+
+#endif  // SCN_BENCHMARK_CORPUS_H
@@ -0,0 +1,47 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_BENCHMARK_CORPUS_BENCH_H
+#define SCN_BENCHMARK_CORPUS_BENCH_H
+
+#include "../corpus.h"
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+struct csv_record {
+    int id{};
+    std::string name{};
+    double price{};
+    int quantity{};
+};
+
+inline int scanf_corpus_value(const char* ptr, int& i, int& n)
+{
+    return sscanf(ptr, "%d%n", &i, &n);
+}
+inline int scanf_corpus_value(const char* ptr, long long& i, int& n)
+{
+    return sscanf(ptr, "%lld%n", &i, &n);
+}
+inline int scanf_corpus_value(const char* ptr, double& d, int& n)
+{
+    return sscanf(ptr, "%lf%n", &d, &n);
+}
+
+#endif  // SCN_BENCHMARK_CORPUS_BENCH_H
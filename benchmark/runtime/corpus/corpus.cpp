@@ -0,0 +1,208 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "bench_corpus.h"
+
+template <typename T>
+static void scan_corpus_scn(benchmark::State& state, const std::string& data)
+{
+    T value{};
+    auto result = scn::make_result(data);
+    for (auto _ : state) {
+        result = scn::scan(result.range(), "{}", value);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                state.PauseTiming();
+                result = scn::make_result(data);
+                state.ResumeTiming();
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * data.size() /
+                             static_cast<size_t>(CORPUS_DATA_N)));
+}
+
+template <typename T>
+static void scan_corpus_sstream(benchmark::State& state,
+                                const std::string& data)
+{
+    T value{};
+    auto stream = std::istringstream{data};
+    for (auto _ : state) {
+        stream >> value;
+
+        if (stream.eof()) {
+            state.PauseTiming();
+            stream = std::istringstream{data};
+            state.ResumeTiming();
+            continue;
+        }
+        if (stream.fail()) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * data.size() /
+                             static_cast<size_t>(CORPUS_DATA_N)));
+}
+
+template <typename T>
+static void scan_corpus_scanf(benchmark::State& state,
+                              const std::string& data)
+{
+    T value{};
+    auto ptr = data.c_str();
+    for (auto _ : state) {
+        int n = 0;
+        auto ret = scanf_corpus_value(ptr, value, n);
+
+        if (ret != 1) {
+            if (ret == EOF) {
+                ptr = data.c_str();
+                continue;
+            }
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        ptr += n;
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * data.size() /
+                             static_cast<size_t>(CORPUS_DATA_N)));
+}
+
+#define SCN_CORPUS_BENCHMARK(corpus, type, impl)                 \
+    static void corpus_##corpus##_##impl(benchmark::State& state) \
+    {                                                             \
+        scan_corpus_##impl<type>(state, corpus_##corpus());       \
+    }                                                             \
+    BENCHMARK(corpus_##corpus##_##impl)
+
+#define SCN_CORPUS_BENCHMARKS(corpus, type)       \
+    SCN_CORPUS_BENCHMARK(corpus, type, scn);     \
+    SCN_CORPUS_BENCHMARK(corpus, type, sstream); \
+    SCN_CORPUS_BENCHMARK(corpus, type, scanf)
+
+SCN_CORPUS_BENCHMARKS(short_ints, int);
+SCN_CORPUS_BENCHMARKS(long_ints, long long);
+SCN_CORPUS_BENCHMARKS(mixed_sign_ints, int);
+SCN_CORPUS_BENCHMARKS(scientific_floats, double);
+
+SCN_CORPUS_BENCHMARK(utf8_words, std::string, scn);
+SCN_CORPUS_BENCHMARK(utf8_words, std::string, sstream);
+
+static void corpus_utf8_words_scn_view(benchmark::State& state)
+{
+    scan_corpus_scn<scn::string_view>(state, corpus_utf8_words());
+}
+BENCHMARK(corpus_utf8_words_scn_view);
+
+static void corpus_csv_scn(benchmark::State& state)
+{
+    const auto& data = corpus_csv_lines();
+    csv_record record{};
+    auto result = scn::make_result(data);
+    for (auto _ : state) {
+        result = scn::scan(result.range(), "{},{:[^,]},{},{}", record.id,
+                           record.name, record.price, record.quantity);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                state.PauseTiming();
+                result = scn::make_result(data);
+                state.ResumeTiming();
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(record);
+    }
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * data.size() /
+                             static_cast<size_t>(CORPUS_DATA_N)));
+}
+BENCHMARK(corpus_csv_scn);
+
+static void corpus_csv_sstream(benchmark::State& state)
+{
+    const auto& data = corpus_csv_lines();
+    csv_record record{};
+    auto stream = std::istringstream{data};
+    for (auto _ : state) {
+        char sep{};
+        stream >> record.id >> sep;
+        std::getline(stream, record.name, ',');
+        stream >> record.price >> sep >> record.quantity;
+
+        if (stream.eof()) {
+            state.PauseTiming();
+            stream = std::istringstream{data};
+            state.ResumeTiming();
+            continue;
+        }
+        if (stream.fail()) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        benchmark::DoNotOptimize(record);
+    }
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * data.size() /
+                             static_cast<size_t>(CORPUS_DATA_N)));
+}
+BENCHMARK(corpus_csv_sstream);
+
+static void corpus_csv_scanf(benchmark::State& state)
+{
+    const auto& data = corpus_csv_lines();
+    csv_record record{};
+    char name[64]{};
+    auto ptr = data.c_str();
+    for (auto _ : state) {
+        int n = 0;
+        auto ret = sscanf(ptr, "%d,%63[^,],%lf,%d%n", &record.id, name,
+                          &record.price, &record.quantity, &n);
+
+        if (ret != 4) {
+            if (ret == EOF) {
+                ptr = data.c_str();
+                continue;
+            }
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        ptr += n;
+        benchmark::DoNotOptimize(record);
+        benchmark::DoNotOptimize(name);
+    }
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * data.size() /
+                             static_cast<size_t>(CORPUS_DATA_N)));
+}
+BENCHMARK(corpus_csv_scanf);
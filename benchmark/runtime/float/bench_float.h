@@ -18,7 +18,7 @@
 #ifndef SCN_BENCHMARK_FLOAT_H
 #define SCN_BENCHMARK_FLOAT_H
 
-#include "../benchmark.h"
+#include "../corpus.h"
 
 #include <cmath>
 #include <cstdio>
@@ -28,23 +28,23 @@
 
 #define FLOAT_DATA_N (static_cast<size_t>(2 << 12))
 
+// In [0, 1), scaled by 2^-16 to 2^16
 template <typename T>
-T generate_single_float()
+T generate_single_float(std::mt19937_64& rng)
 {
-    static std::uniform_int_distribution<int> int_dist(-16, 16);
-    static std::uniform_real_distribution<T> float_dist(T(0.0), T(1.0));
-    auto f = float_dist(get_rng());
-    auto exp = int_dist(get_rng());
+    auto f = static_cast<T>(corpus_uniform_real(rng, 0.0, 1.0));
+    auto exp = static_cast<int>(corpus_uniform(rng, 0, 32)) - 16;
     return std::scalbn(f, exp);
 }
 
 template <typename Float>
 std::vector<std::string> stringified_floats_list(size_t n = FLOAT_DATA_N)
 {
+    auto rng = make_corpus_rng("floats_list");
     std::vector<std::string> ret;
     for (size_t i = 0; i < n; ++i) {
         std::ostringstream oss;
-        oss << generate_single_float<Float>();
+        oss << generate_single_float<Float>(rng);
         ret.push_back(std::move(oss).str());
     }
     return ret;
@@ -54,9 +54,10 @@ template <typename Float>
 std::string stringified_float_list(size_t n = FLOAT_DATA_N,
                                    const char* delim = " ")
 {
+    auto rng = make_corpus_rng("float_list");
     std::ostringstream oss;
     for (size_t i = 0; i < n; ++i) {
-        oss << generate_single_float<Float>() << delim;
+        oss << generate_single_float<Float>(rng) << delim;
     }
     return oss.str();
 }
@@ -18,24 +18,36 @@
 #ifndef SCN_BENCHMARK_INTEGER_H
 #define SCN_BENCHMARK_INTEGER_H
 
-#include "../benchmark.h"
+#include "../corpus.h"
 
 #include <cstdio>
+#include <cstring>
 #include <limits>
+#include <type_traits>
 #include <sstream>
 #include <vector>
 
 #define INT_DATA_N (static_cast<size_t>(2 << 12))
 
+// Uniformly distributed over the range of `Int`
+template <typename Int>
+Int generate_single_int(std::mt19937_64& rng)
+{
+    using unsigned_type = typename std::make_unsigned<Int>::type;
+    const auto u = static_cast<unsigned_type>(rng());
+    Int ret;
+    std::memcpy(&ret, &u, sizeof(Int));
+    return ret;
+}
+
 template <typename Int>
 std::vector<std::string> stringified_integers_list(size_t n = INT_DATA_N)
 {
-    static std::uniform_int_distribution<Int> dist(
-        std::numeric_limits<Int>::min(), std::numeric_limits<Int>::max());
+    auto rng = make_corpus_rng("integers_list");
     std::vector<std::string> ret;
     for (size_t i = 0; i < n; ++i) {
         std::ostringstream oss;
-        oss << dist(get_rng());
+        oss << generate_single_int<Int>(rng);
         ret.push_back(std::move(oss).str());
     }
     return ret;
@@ -45,12 +57,10 @@ template <typename Int>
 std::string stringified_integer_list(size_t n = INT_DATA_N,
                                      const char* delim = " ")
 {
-    static std::uniform_int_distribution<Int> dist(
-        std::numeric_limits<Int>::min(), std::numeric_limits<Int>::max());
-
+    auto rng = make_corpus_rng("integer_list");
     std::ostringstream oss;
     for (size_t i = 0; i < n; ++i) {
-        oss << dist(get_rng()) << delim;
+        oss << generate_single_int<Int>(rng) << delim;
     }
     return oss.str();
 }
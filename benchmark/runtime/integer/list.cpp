@@ -102,6 +102,7 @@ static void scan_int_list_scn_list(benchmark::State& state)
     read.reserve(n);
 
     for (auto _ : state) {
+        read.clear();
         auto result = scn::scan_list(data, read);
         if (!result) {
             state.SkipWithError("Benchmark errored");
@@ -111,7 +112,38 @@ static void scan_int_list_scn_list(benchmark::State& state)
     state.SetBytesProcessed(state.iterations() *
                             static_cast<int64_t>(n * sizeof(int)));
 }
-BENCHMARK(scan_int_list_scn_list)->Arg(16)->Arg(64)->Arg(256);
+BENCHMARK(scan_int_list_scn_list)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+
+static void scan_int_list_scn_list_comma(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    auto data = stringified_integer_list<int>(n, ",");
+    std::vector<int> read;
+    read.reserve(n);
+
+    for (auto _ : state) {
+        read.clear();
+        auto result =
+            scn::scan_list_ex(data, read, scn::list_separator(','));
+        if (!result) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(n * sizeof(int)));
+}
+BENCHMARK(scan_int_list_scn_list_comma)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
 
 static void scan_int_list_sstream(benchmark::State& state)
 {
@@ -0,0 +1,170 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_BENCHMARK_OTHER_H
+#define SCN_BENCHMARK_OTHER_H
+
+#include "../corpus.h"
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define OTHER_DATA_N (static_cast<size_t>(2 << 12))
+
+inline const std::string& word_chars()
+{
+    static const std::string chars =
+        "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    return chars;
+}
+
+// `n` lines of 1 to 8 words, separated by a single space
+inline std::string generate_lines(size_t n = OTHER_DATA_N)
+{
+    auto rng = make_corpus_rng("lines");
+    const auto char_count = word_chars().size();
+
+    std::string ret;
+    for (size_t i = 0; i < n; ++i) {
+        const auto words = corpus_uniform(rng, 1, 8);
+        for (std::uint64_t w = 0; w < words; ++w) {
+            if (w != 0) {
+                ret.push_back(' ');
+            }
+            const auto len = corpus_uniform(rng, 1, 12);
+            for (std::uint64_t c = 0; c < len; ++c) {
+                ret.push_back(
+                    word_chars()[corpus_uniform(rng, 0, char_count - 1)]);
+            }
+        }
+        ret.push_back('\n');
+    }
+    return ret;
+}
+
+// `n` words of lowercase letters, followed by a digit or a punctuation
+// character, separated by a single space
+inline std::string generate_set_words(size_t n = OTHER_DATA_N)
+{
+    static const std::string tails = "0123456789.,;:";
+    auto rng = make_corpus_rng("set_words");
+
+    std::string ret;
+    for (size_t i = 0; i < n; ++i) {
+        const auto len = corpus_uniform(rng, 1, 12);
+        for (std::uint64_t c = 0; c < len; ++c) {
+            ret.push_back(static_cast<char>(corpus_uniform(rng, 'a', 'z')));
+        }
+        ret.push_back(tails[corpus_uniform(rng, 0, tails.size() - 1)]);
+        ret.push_back(' ');
+    }
+    return ret;
+}
+
+// `n` of "true" or "false" if `alpha`, "1" or "0" otherwise
+inline std::string generate_bools(size_t n = OTHER_DATA_N, bool alpha = true)
+{
+    auto rng = make_corpus_rng("bools");
+
+    std::string ret;
+    for (size_t i = 0; i < n; ++i) {
+        const auto b = corpus_uniform(rng, 0, 1) != 0;
+        if (alpha) {
+            ret.append(b ? "true " : "false ");
+        }
+        else {
+            ret.append(b ? "1 " : "0 ");
+        }
+    }
+    return ret;
+}
+
+// `n` UTF-8 encoded code points, a third of them one, two and three code
+// units long, with no whitespace
+inline std::string generate_code_points(size_t n = OTHER_DATA_N)
+{
+    auto rng = make_corpus_rng("code_points");
+
+    std::string ret;
+    for (size_t i = 0; i < n; ++i) {
+        switch (corpus_uniform(rng, 1, 3)) {
+            case 1:
+                ret.push_back(
+                    static_cast<char>(corpus_uniform(rng, 0x21, 0x7e)));
+                break;
+            case 2: {
+                const auto cp = corpus_uniform(rng, 0x80, 0x7ff);
+                ret.push_back(static_cast<char>(0xc0 | (cp >> 6)));
+                ret.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+                break;
+            }
+            default: {
+                const auto cp = corpus_uniform(rng, 0x800, 0xd7ff);
+                ret.push_back(static_cast<char>(0xe0 | (cp >> 12)));
+                ret.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3f)));
+                ret.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+                break;
+            }
+        }
+    }
+    return ret;
+}
+
+// `n` integers, separated by `delim`
+inline std::string generate_int_list(size_t n = OTHER_DATA_N,
+                                     const char* delim = ", ")
+{
+    auto rng = make_corpus_rng("int_list");
+
+    std::ostringstream oss;
+    for (size_t i = 0; i < n; ++i) {
+        if (i != 0) {
+            oss << delim;
+        }
+        oss << static_cast<int>(corpus_uniform(rng, 0, 200000)) - 100000;
+    }
+    return oss.str();
+}
+
+// `n` doubles, separated by a single space
+inline std::string generate_double_list(size_t n = OTHER_DATA_N)
+{
+    auto rng = make_corpus_rng("double_list");
+
+    std::ostringstream oss;
+    oss.precision(10);
+    for (size_t i = 0; i < n; ++i) {
+        oss << corpus_uniform_real(rng, -1e6, 1e6) << ' ';
+    }
+    return oss.str();
+}
+
+// Writes `data` into a file called `name` in the working directory
+inline bool write_bench_file(const char* name, const std::string& data)
+{
+    auto f = std::fopen(name, "wb");
+    if (!f) {
+        return false;
+    }
+    const auto written = std::fwrite(data.data(), 1, data.size(), f);
+    std::fclose(f);
+    return written == data.size();
+}
+
+#endif  // SCN_BENCHMARK_OTHER_H
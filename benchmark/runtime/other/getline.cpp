@@ -0,0 +1,213 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "bench_other.h"
+
+#include <cstring>
+#include <limits>
+
+static void getline_scn(benchmark::State& state)
+{
+    auto data = generate_lines();
+    std::string line{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        result = scn::getline(result.range(), line);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += line.size() + 1;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(getline_scn);
+
+static void getline_scn_view(benchmark::State& state)
+{
+    auto data = generate_lines();
+    scn::string_view line{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        result = scn::getline(result.range(), line);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += line.size() + 1;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(getline_scn_view);
+
+static void getline_scn_lines(benchmark::State& state)
+{
+    auto data = generate_lines();
+    auto view = scn::lines(data);
+    auto it = view.begin();
+    size_t size = 0;
+    for (auto _ : state) {
+        if (it == view.end()) {
+            it = view.begin();
+        }
+        auto line = *it;
+        benchmark::DoNotOptimize(line);
+        size += line.size() + 1;
+        ++it;
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(getline_scn_lines);
+
+static void getline_sstream(benchmark::State& state)
+{
+    auto data = generate_lines();
+    auto stream = std::istringstream(data);
+    std::string line{};
+    size_t size = 0;
+    for (auto _ : state) {
+        std::getline(stream, line);
+
+        if (stream.eof()) {
+            stream = std::istringstream(data);
+        }
+        else if (stream.fail()) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            size += line.size() + 1;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(getline_sstream);
+
+static void getline_scanf(benchmark::State& state)
+{
+    auto data = generate_lines();
+    std::vector<char> line(data.size() + 1);
+    auto ptr = data.c_str();
+    size_t size = 0;
+    for (auto _ : state) {
+        int n = 0;
+        auto ret = sscanf(ptr, "%[^\n]%n", line.data(), &n);
+
+        if (ret == EOF) {
+            ptr = data.c_str();
+        }
+        else if (ret != 1) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            ptr += n + 1;
+            size += static_cast<size_t>(n) + 1;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(getline_scanf);
+
+static void ignore_until_scn(benchmark::State& state)
+{
+    auto data = generate_lines();
+    auto source = scn::string_view{data.data(), data.size()};
+    auto result = scn::make_result(source);
+    size_t size = 0;
+    for (auto _ : state) {
+        const auto before = static_cast<size_t>(result.range().size());
+        result = scn::ignore_until(result.range(), '\n');
+
+        if (!result) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        // ignore_until stops at the newline: skip over it
+        auto rest = result.range_as_string_view();
+        if (rest.size() <= 1) {
+            size += before;
+            result = scn::make_result(source);
+            continue;
+        }
+        rest.remove_prefix(1);
+        size += before - rest.size();
+        result = scn::make_result(rest);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(ignore_until_scn);
+
+static void ignore_until_sstream(benchmark::State& state)
+{
+    auto data = generate_lines();
+    auto stream = std::istringstream(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        stream.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        size += static_cast<size_t>(stream.gcount());
+
+        if (stream.eof() || stream.peek() == EOF) {
+            stream = std::istringstream(data);
+        }
+        else if (stream.fail()) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(ignore_until_sstream);
+
+static void ignore_until_scanf(benchmark::State& state)
+{
+    auto data = generate_lines();
+    auto ptr = data.c_str();
+    size_t size = 0;
+    for (auto _ : state) {
+        int n = 0;
+        auto ret = sscanf(ptr, "%*[^\n]%n", &n);
+
+        if (ret == EOF || *ptr == '\0') {
+            ptr = data.c_str();
+        }
+        else {
+            ptr += n + 1;
+            size += static_cast<size_t>(n) + 1;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(ignore_until_scanf);
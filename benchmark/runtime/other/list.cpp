@@ -0,0 +1,148 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "bench_other.h"
+
+static void list_separator_scn(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    auto data = generate_int_list(n, ", ");
+    std::vector<int> read;
+    read.reserve(n);
+
+    for (auto _ : state) {
+        read.clear();
+        auto result =
+            scn::scan_list_ex(data, read, scn::list_separator(','));
+        if (!result || read.size() != n) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(data.size()));
+}
+BENCHMARK(list_separator_scn)->Arg(16)->Arg(256)->Arg(1 << 16);
+
+static void list_separator_scn_until(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    auto data = generate_int_list(n, ", ") + "\nrest";
+    std::vector<int> read;
+    read.reserve(n);
+
+    for (auto _ : state) {
+        read.clear();
+        auto result = scn::scan_list_ex(
+            data, read, scn::list_separator_and_until(',', '\n'));
+        if (!result || read.size() != n) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(data.size()));
+}
+BENCHMARK(list_separator_scn_until)->Arg(16)->Arg(256)->Arg(1 << 16);
+
+static void list_separator_scn_loop(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    auto data = generate_int_list(n, ", ");
+    std::vector<int> read;
+    read.reserve(n);
+
+    for (auto _ : state) {
+        read.clear();
+        int i{};
+        auto result = scn::scan_default(data, i);
+        while (result) {
+            read.push_back(i);
+            result = scn::scan(result.range(), ", {}", i);
+        }
+        if (result.error() != scn::error::end_of_range ||
+            read.size() != n) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(data.size()));
+}
+BENCHMARK(list_separator_scn_loop)->Arg(16)->Arg(256)->Arg(1 << 16);
+
+static void list_separator_sstream(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    auto data = generate_int_list(n, ", ");
+    std::vector<int> read;
+    read.reserve(n);
+
+    for (auto _ : state) {
+        read.clear();
+        std::istringstream iss{data};
+        int i;
+        char sep;
+        while (iss >> i) {
+            read.push_back(i);
+            if (!(iss >> sep)) {
+                break;
+            }
+        }
+        if (read.size() != n) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(data.size()));
+}
+BENCHMARK(list_separator_sstream)->Arg(16)->Arg(256)->Arg(1 << 16);
+
+static void list_separator_scanf(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    auto data = generate_int_list(n, ", ");
+    std::vector<int> read;
+    read.reserve(n);
+
+    for (auto _ : state) {
+        read.clear();
+        auto ptr = data.c_str();
+        while (true) {
+            int i, chars = 0;
+            auto ret = sscanf(ptr, "%d%n", &i, &chars);
+            if (ret != 1) {
+                break;
+            }
+            read.push_back(i);
+            ptr += chars;
+            if (*ptr != ',') {
+                break;
+            }
+            ++ptr;
+        }
+        if (read.size() != n) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(data.size()));
+}
+// sscanf calls strlen on every call, so it's quadratic on long inputs
+BENCHMARK(list_separator_scanf)->Arg(16)->Arg(256);
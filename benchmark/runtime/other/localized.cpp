@@ -0,0 +1,244 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "bench_other.h"
+
+#include <clocale>
+#include <locale>
+
+// The classic locale is used, so that the results only show the overhead
+// of going through the localized code paths, and the benchmark can be run
+// on systems without any other locales installed
+
+static void localized_int_scn(benchmark::State& state)
+{
+    auto data = generate_int_list(OTHER_DATA_N, " ");
+    int i{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = result.range().size();
+        result = scn::scan(result.range(), "{}", i);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += static_cast<size_t>(before - result.range().size());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(localized_int_scn);
+
+static void localized_int_scn_L(benchmark::State& state)
+{
+    auto data = generate_int_list(OTHER_DATA_N, " ");
+    const auto& loc = std::locale::classic();
+    int i{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = result.range().size();
+        result = scn::scan_localized(loc, result.range(), "{:L}", i);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += static_cast<size_t>(before - result.range().size());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(localized_int_scn_L);
+
+static void localized_int_scn_n(benchmark::State& state)
+{
+    auto data = generate_int_list(OTHER_DATA_N, " ");
+    const auto& loc = std::locale::classic();
+    int i{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = result.range().size();
+        result = scn::scan_localized(loc, result.range(), "{:n}", i);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += static_cast<size_t>(before - result.range().size());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(localized_int_scn_n);
+
+static void localized_int_sstream(benchmark::State& state)
+{
+    auto data = generate_int_list(OTHER_DATA_N, " ");
+    auto stream = std::istringstream(data);
+    stream.imbue(std::locale::classic());
+    int i{};
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = stream.tellg();
+        stream >> i;
+
+        if (stream.eof()) {
+            stream = std::istringstream(data);
+            stream.imbue(std::locale::classic());
+        }
+        else if (stream.fail()) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            size += static_cast<size_t>(stream.tellg() - before);
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(localized_int_sstream);
+
+static void localized_double_scn(benchmark::State& state)
+{
+    auto data = generate_double_list();
+    double d{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = result.range().size();
+        result = scn::scan(result.range(), "{}", d);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += static_cast<size_t>(before - result.range().size());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(localized_double_scn);
+
+static void localized_double_scn_L(benchmark::State& state)
+{
+    auto data = generate_double_list();
+    const auto& loc = std::locale::classic();
+    double d{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = result.range().size();
+        result = scn::scan_localized(loc, result.range(), "{:L}", d);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += static_cast<size_t>(before - result.range().size());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(localized_double_scn_L);
+
+static void localized_double_sstream(benchmark::State& state)
+{
+    auto data = generate_double_list();
+    auto stream = std::istringstream(data);
+    stream.imbue(std::locale::classic());
+    double d{};
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = stream.tellg();
+        stream >> d;
+
+        if (stream.eof()) {
+            stream = std::istringstream(data);
+            stream.imbue(std::locale::classic());
+        }
+        else if (stream.fail()) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            size += static_cast<size_t>(stream.tellg() - before);
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(localized_double_sstream);
+
+static void localized_double_scanf(benchmark::State& state)
+{
+    auto data = generate_double_list();
+    std::setlocale(LC_NUMERIC, "C");
+    double d{};
+    auto ptr = data.c_str();
+    size_t size = 0;
+    for (auto _ : state) {
+        int n = 0;
+        auto ret = sscanf(ptr, "%lf%n", &d, &n);
+
+        if (ret == EOF) {
+            ptr = data.c_str();
+        }
+        else if (ret != 1) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            ptr += n;
+            size += static_cast<size_t>(n);
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(localized_double_scanf);
@@ -0,0 +1,167 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "bench_other.h"
+
+#include <fstream>
+
+// The same list of integers, read from a `scn::string_view`, a
+// `scn::mapped_file`, and a `scn::file`
+
+#define SOURCE_FILE_NAME "bench-source.txt"
+
+static std::string prepare_source_file(benchmark::State& state)
+{
+    auto data = generate_int_list(static_cast<size_t>(state.range(0)), " ");
+    if (!write_bench_file(SOURCE_FILE_NAME, data)) {
+        state.SkipWithError("Failed to write " SOURCE_FILE_NAME);
+    }
+    return data;
+}
+
+template <typename Range>
+static bool scan_all_ints(Range&& r, std::vector<int>& read)
+{
+    int i{};
+    auto result = scn::scan_default(SCN_FWD(r), i);
+    while (result) {
+        read.push_back(i);
+        result = scn::scan_default(result.range(), i);
+    }
+    return result.error() == scn::error::end_of_range;
+}
+
+static void source_string_view_scn(benchmark::State& state)
+{
+    auto data = prepare_source_file(state);
+    std::vector<int> read;
+
+    for (auto _ : state) {
+        read.clear();
+        if (!scan_all_ints(scn::string_view{data}, read)) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(data.size()));
+}
+BENCHMARK(source_string_view_scn)->Arg(256)->Arg(4096);
+
+static void source_string_view_scn_list(benchmark::State& state)
+{
+    auto data = prepare_source_file(state);
+    std::vector<int> read;
+
+    for (auto _ : state) {
+        read.clear();
+        auto result = scn::scan_list(scn::string_view{data}, read);
+        if (!result) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(data.size()));
+}
+BENCHMARK(source_string_view_scn_list)->Arg(256)->Arg(4096);
+
+static void source_mapped_file_scn(benchmark::State& state)
+{
+    auto data = prepare_source_file(state);
+    std::vector<int> read;
+
+    for (auto _ : state) {
+        read.clear();
+        scn::mapped_file file{SOURCE_FILE_NAME};
+        if (!file.valid() || !scan_all_ints(file, read)) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(data.size()));
+}
+BENCHMARK(source_mapped_file_scn)->Arg(256)->Arg(4096);
+
+static void source_file_scn(benchmark::State& state)
+{
+    auto data = prepare_source_file(state);
+    std::vector<int> read;
+
+    for (auto _ : state) {
+        read.clear();
+        scn::owning_file file{SOURCE_FILE_NAME, "rb"};
+        if (!file.is_open() || !scan_all_ints(file, read)) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(data.size()));
+}
+BENCHMARK(source_file_scn)->Arg(256)->Arg(4096);
+
+static void source_fstream(benchmark::State& state)
+{
+    auto data = prepare_source_file(state);
+    std::vector<int> read;
+
+    for (auto _ : state) {
+        read.clear();
+        std::ifstream file{SOURCE_FILE_NAME};
+        int i;
+        while (file >> i) {
+            read.push_back(i);
+        }
+        if (!file.eof()) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(data.size()));
+}
+BENCHMARK(source_fstream)->Arg(256)->Arg(4096);
+
+static void source_fscanf(benchmark::State& state)
+{
+    auto data = prepare_source_file(state);
+    std::vector<int> read;
+
+    for (auto _ : state) {
+        read.clear();
+        auto file = std::fopen(SOURCE_FILE_NAME, "rb");
+        if (!file) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        int i;
+        while (fscanf(file, "%d", &i) == 1) {
+            read.push_back(i);
+        }
+        const auto eof = std::feof(file) != 0;
+        std::fclose(file);
+        if (!eof) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(data.size()));
+}
+BENCHMARK(source_fscanf)->Arg(256)->Arg(4096);
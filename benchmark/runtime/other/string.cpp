@@ -0,0 +1,341 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "bench_other.h"
+
+#include <cstring>
+
+static void string_set_scn(benchmark::State& state)
+{
+    auto data = generate_set_words();
+    std::string word{};
+    char tail{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        result = scn::scan(result.range(), " {:[a-z]}{}", word, tail);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += word.size() + 2;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(string_set_scn);
+
+static void string_set_scn_view(benchmark::State& state)
+{
+    auto data = generate_set_words();
+    scn::string_view word{};
+    char tail{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        result = scn::scan(result.range(), " {:[a-z]}{}", word, tail);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += word.size() + 2;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(string_set_scn_view);
+
+static void string_set_sstream(benchmark::State& state)
+{
+    auto data = generate_set_words();
+    auto stream = std::istringstream(data);
+    std::string word{};
+    size_t size = 0;
+    for (auto _ : state) {
+        word.clear();
+        stream >> std::ws;
+        while (true) {
+            auto ch = stream.peek();
+            if (ch < 'a' || ch > 'z') {
+                break;
+            }
+            word.push_back(static_cast<char>(stream.get()));
+        }
+        stream.get();
+
+        if (stream.eof()) {
+            stream = std::istringstream(data);
+        }
+        else if (stream.fail() || word.empty()) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            size += word.size() + 2;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(string_set_sstream);
+
+static void string_set_scanf(benchmark::State& state)
+{
+    auto data = generate_set_words();
+    char word[16] = {0};
+    auto ptr = data.c_str();
+    size_t size = 0;
+    for (auto _ : state) {
+        int n = 0;
+        auto ret = sscanf(ptr, " %15[a-z]%*c%n", word, &n);
+
+        if (ret == EOF) {
+            ptr = data.c_str();
+        }
+        else if (ret != 1) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            ptr += n;
+            size += std::strlen(word) + 2;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(string_set_scanf);
+
+static void bool_scn(benchmark::State& state)
+{
+    auto data = generate_bools();
+    bool b{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        result = scn::scan_default(result.range(), b);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += b ? 5 : 6;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(bool_scn);
+
+static void bool_scn_numeric(benchmark::State& state)
+{
+    auto data = generate_bools(OTHER_DATA_N, false);
+    bool b{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        result = scn::scan(result.range(), "{:i}", b);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += 2;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(bool_scn_numeric);
+
+static void bool_sstream(benchmark::State& state)
+{
+    auto data = generate_bools();
+    auto stream = std::istringstream(data);
+    stream >> std::boolalpha;
+    bool b{};
+    size_t size = 0;
+    for (auto _ : state) {
+        stream >> b;
+
+        if (stream.eof()) {
+            stream = std::istringstream(data);
+            stream >> std::boolalpha;
+        }
+        else if (stream.fail()) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            size += b ? 5 : 6;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(bool_sstream);
+
+static void bool_scanf(benchmark::State& state)
+{
+    auto data = generate_bools();
+    char buf[6] = {0};
+    auto ptr = data.c_str();
+    size_t size = 0;
+    for (auto _ : state) {
+        int n = 0;
+        auto ret = sscanf(ptr, "%5s%n", buf, &n);
+
+        if (ret == EOF) {
+            ptr = data.c_str();
+        }
+        else if (ret != 1) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            auto b = std::strcmp(buf, "true") == 0;
+            benchmark::DoNotOptimize(b);
+            ptr += n;
+            size += static_cast<size_t>(n);
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(bool_scanf);
+
+static void code_point_scn(benchmark::State& state)
+{
+    auto data = generate_code_points();
+    scn::code_point cp{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = result.range().size();
+        result = scn::scan_default(result.range(), cp);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += static_cast<size_t>(before - result.range().size());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(code_point_scn);
+
+static void code_point_scn_char(benchmark::State& state)
+{
+    auto data = generate_code_points();
+    char ch{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        result = scn::scan_default(result.range(), ch);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            ++size;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(code_point_scn_char);
+
+static void code_point_sstream(benchmark::State& state)
+{
+    auto data = generate_code_points();
+    auto stream = std::istringstream(data);
+    char ch{};
+    size_t size = 0;
+    for (auto _ : state) {
+        stream.get(ch);
+
+        if (stream.eof()) {
+            stream = std::istringstream(data);
+        }
+        else if (stream.fail()) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            ++size;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(code_point_sstream);
+
+static void code_point_scanf(benchmark::State& state)
+{
+    auto data = generate_code_points();
+    char ch{};
+    auto ptr = data.c_str();
+    size_t size = 0;
+    for (auto _ : state) {
+        auto ret = sscanf(ptr, "%c", &ch);
+
+        if (ret == EOF) {
+            ptr = data.c_str();
+        }
+        else if (ret != 1) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            ++ptr;
+            ++size;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(code_point_scanf);
@@ -0,0 +1,167 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "bench_other.h"
+
+struct int_and_double {
+    int i;
+    double d;
+};
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    template <>
+    struct scanner<int_and_double> : public empty_parser {
+        template <typename Context>
+        error scan(int_and_double& val, Context& ctx)
+        {
+            return scan_usertype(ctx, "[{}, {}]", val.i, val.d);
+        }
+    };
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+static std::istream& operator>>(std::istream& is, int_and_double& val)
+{
+    char open, comma, close;
+    is >> open >> val.i >> comma >> val.d >> close;
+    if (open != '[' || comma != ',' || close != ']') {
+        is.setstate(std::ios_base::failbit);
+    }
+    return is;
+}
+
+static std::string generate_int_and_doubles(size_t n = OTHER_DATA_N)
+{
+    auto rng = make_corpus_rng("int_and_doubles");
+
+    std::ostringstream oss;
+    oss.precision(10);
+    for (size_t i = 0; i < n; ++i) {
+        oss << '['
+            << static_cast<int>(corpus_uniform(rng, 0, 200000)) - 100000
+            << ", " << corpus_uniform_real(rng, -1e6, 1e6) << "] ";
+    }
+    return oss.str();
+}
+
+static void usertype_scn(benchmark::State& state)
+{
+    auto data = generate_int_and_doubles();
+    int_and_double val{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = result.range().size();
+        result = scn::scan_default(result.range(), val);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += static_cast<size_t>(before - result.range().size());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(usertype_scn);
+
+static void usertype_scn_inline(benchmark::State& state)
+{
+    auto data = generate_int_and_doubles();
+    int_and_double val{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = result.range().size();
+        result = scn::scan(result.range(), " [{}, {}]", val.i, val.d);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += static_cast<size_t>(before - result.range().size());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(usertype_scn_inline);
+
+static void usertype_sstream(benchmark::State& state)
+{
+    auto data = generate_int_and_doubles();
+    auto stream = std::istringstream(data);
+    int_and_double val{};
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = stream.tellg();
+        stream >> val;
+
+        if (stream.eof()) {
+            stream = std::istringstream(data);
+        }
+        else if (stream.fail()) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            size += static_cast<size_t>(stream.tellg() - before);
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(usertype_sstream);
+
+static void usertype_scanf(benchmark::State& state)
+{
+    auto data = generate_int_and_doubles();
+    int_and_double val{};
+    auto ptr = data.c_str();
+    size_t size = 0;
+    for (auto _ : state) {
+        int n = 0;
+        auto ret = sscanf(ptr, " [%d, %lf]%n", &val.i, &val.d, &n);
+
+        if (ret == EOF) {
+            ptr = data.c_str();
+        }
+        else if (ret != 2) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            ptr += n;
+            size += static_cast<size_t>(n);
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(usertype_scanf);
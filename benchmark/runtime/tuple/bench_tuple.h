@@ -0,0 +1,53 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_BENCHMARK_TUPLE_H
+#define SCN_BENCHMARK_TUPLE_H
+
+#include "../corpus.h"
+
+#include <scn/tuple_return.h>
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#define TUPLE_DATA_N (static_cast<size_t>(2 << 12))
+
+// `n` records of an int, a double, and a word of up to 15 characters,
+// each on its own line
+inline std::string generate_records(size_t n = TUPLE_DATA_N)
+{
+    static const std::string chars =
+        "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    auto rng = make_corpus_rng("records");
+
+    std::ostringstream oss;
+    oss.precision(10);
+    for (size_t i = 0; i < n; ++i) {
+        oss << static_cast<int>(corpus_uniform(rng, 0, 200000)) - 100000
+            << ' ' << corpus_uniform_real(rng, -1e6, 1e6) << ' ';
+        const auto len = corpus_uniform(rng, 1, 15);
+        for (std::uint64_t c = 0; c < len; ++c) {
+            oss << chars[corpus_uniform(rng, 0, chars.size() - 1)];
+        }
+        oss << '\n';
+    }
+    return oss.str();
+}
+
+#endif  // SCN_BENCHMARK_TUPLE_H
@@ -0,0 +1,162 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "bench_tuple.h"
+
+static void tuple_scn(benchmark::State& state)
+{
+    auto data = generate_records();
+    int i{};
+    double d{};
+    std::string s{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = result.range().size();
+        result = scn::scan(result.range(), "{} {} {}", i, d, s);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += static_cast<size_t>(before - result.range().size());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(tuple_scn);
+
+static void tuple_scn_default(benchmark::State& state)
+{
+    auto data = generate_records();
+    int i{};
+    double d{};
+    std::string s{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = result.range().size();
+        result = scn::scan_default(result.range(), i, d, s);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += static_cast<size_t>(before - result.range().size());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(tuple_scn_default);
+
+static void tuple_scn_tuple(benchmark::State& state)
+{
+    auto data = generate_records();
+    auto range = scn::make_result(data).range();
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = range.size();
+        auto [result, i, d, s] =
+            scn::scan_tuple<int, double, std::string>(range, "{} {} {}");
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                range = scn::make_result(data).range();
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            benchmark::DoNotOptimize(i);
+            benchmark::DoNotOptimize(d);
+            benchmark::DoNotOptimize(s);
+            range = result.range();
+            size += static_cast<size_t>(before - range.size());
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(tuple_scn_tuple);
+
+static void tuple_sstream(benchmark::State& state)
+{
+    auto data = generate_records();
+    auto stream = std::istringstream(data);
+    int i{};
+    double d{};
+    std::string s{};
+    size_t size = 0;
+    for (auto _ : state) {
+        auto before = stream.tellg();
+        stream >> i >> d >> s;
+
+        if (stream.eof()) {
+            stream = std::istringstream(data);
+        }
+        else if (stream.fail()) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            size += static_cast<size_t>(stream.tellg() - before);
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(tuple_sstream);
+
+static void tuple_scanf(benchmark::State& state)
+{
+    auto data = generate_records();
+    int i{};
+    double d{};
+    char s[16] = {0};
+    auto ptr = data.c_str();
+    size_t size = 0;
+    for (auto _ : state) {
+        int n = 0;
+        auto ret = sscanf(ptr, "%d %lf %15s%n", &i, &d, s, &n);
+
+        if (ret == EOF) {
+            ptr = data.c_str();
+        }
+        else if (ret != 3) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            ptr += n;
+            size += static_cast<size_t>(n);
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size));
+}
+BENCHMARK(tuple_scanf);
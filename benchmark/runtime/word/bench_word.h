@@ -18,7 +18,7 @@
 #ifndef SCN_BENCHMARK_WORD_H
 #define SCN_BENCHMARK_WORD_H
 
-#include "../benchmark.h"
+#include "../corpus.h"
 
 #include <cstdio>
 #include <limits>
@@ -87,20 +87,20 @@ template <typename Char>
 std::vector<std::basic_string<Char>> words_list(size_t n)
 {
     static const auto& chars = chars_nospaces<Char>();
-    static std::uniform_int_distribution<> dist(
-        0, static_cast<int>(chars.size() - 1));
+    auto rng = make_corpus_rng("words_list");
 
     std::vector<std::basic_string<Char>> ret;
     ret.reserve(n);
     for (size_t i = 0; i < n; ++i) {
-        auto len = dist(get_rng());
+        auto len =
+            static_cast<size_t>(corpus_uniform(rng, 0, chars.size() - 1));
         if (len == 0) {
             len = 3;
         }
         std::basic_string<Char> str;
-        str.reserve(static_cast<size_t>(len));
-        for (int j = 0; j < len; ++j) {
-            str.push_back(chars[static_cast<size_t>(dist(get_rng()))]);
+        str.reserve(len);
+        for (size_t j = 0; j < len; ++j) {
+            str.push_back(chars[corpus_uniform(rng, 0, chars.size() - 1)]);
         }
         ret.push_back(std::move(str));
     }
@@ -110,13 +110,12 @@ template <typename Char>
 std::basic_string<Char> word_list(size_t n)
 {
     static const auto& chars = chars_spaces<Char>();
-    static std::uniform_int_distribution<> dist(
-        0, static_cast<int>(chars.size() - 1));
+    auto rng = make_corpus_rng("word_list");
 
     std::basic_string<Char> ret;
     ret.reserve(n);
     for (size_t i = 0; i < n; ++i) {
-        ret.push_back(chars[static_cast<size_t>(dist(get_rng()))]);
+        ret.push_back(chars[corpus_uniform(rng, 0, chars.size() - 1)]);
     }
     return ret;
 }
@@ -25,6 +25,8 @@ function(get_config_flags flags)
             $<$<BOOL:${SCN_DISABLE_STRTOD}>:          -DSCN_DISABLE_STRTOD=1>
 
             $<$<BOOL:${SCN_DISABLE_LOCALE}>:          -DSCN_DISABLE_LOCALE=1>
+
+            $<$<BOOL:${SCN_ENABLE_STATS}>:            -DSCN_ENABLE_STATS=1>
             PARENT_SCOPE
     )
 endfunction()
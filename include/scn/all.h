@@ -20,7 +20,10 @@
 
 #include "scn.h"
 
+#include "chrono.h"
 #include "istream.h"
+#include "network.h"
+#include "parallel.h"
 #include "tuple_return.h"
 
 #endif  // SCN_ALL_H
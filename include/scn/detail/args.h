@@ -388,7 +388,7 @@ namespace scn {
 
         SCN_NODISCARD constexpr detail::type type() const noexcept
         {
-            return type;
+            return m_type;
         }
         SCN_NODISCARD constexpr bool is_integral() const noexcept
         {
@@ -577,6 +577,22 @@ namespace scn {
         }
     }  // namespace detail
 
+    /**
+     * Returns the number of code units read by scanners of type `T`, from a
+     * source of `CharT`s, counted in `s`.
+     *
+     * \code{.cpp}
+     * auto stats = scn::get_scan_stats();
+     * auto n = scn::chars_read_for<int>(stats);
+     * \endcode
+     */
+    template <typename T, typename CharT = char>
+    std::uint64_t chars_read_for(const scan_stats& s) noexcept
+    {
+        return s.chars_read[static_cast<size_t>(
+            detail::get_type<CharT, T>::value)];
+    }
+
     template <typename CharT, typename... Args>
     class arg_store {
         static constexpr const size_t num_args = sizeof...(Args);
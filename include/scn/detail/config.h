@@ -519,6 +519,11 @@
 #define SCN_DISABLE_LOCALE 0
 #endif
 
+// Define SCN_ENABLE_STATS
+#ifndef SCN_ENABLE_STATS
+#define SCN_ENABLE_STATS 0
+#endif
+
 #define SCN_UNUSED(x) static_cast<void>(sizeof(x))
 
 #if SCN_HAS_RELAXED_CONSTEXPR
@@ -18,6 +18,7 @@
 #ifndef SCN_DETAIL_CONTEXT_H
 #define SCN_DETAIL_CONTEXT_H
 
+#include "../util/memory_resource.h"
 #include "args.h"
 
 namespace scn {
@@ -69,9 +70,42 @@ namespace scn {
             return m_locale;
         }
 
+        /**
+         * Resource to allocate temporaries from while scanning.
+         * Defaults to `get_default_resource()` at the time the context was
+         * constructed.
+         */
+        memory_resource* resource() const noexcept
+        {
+            return m_resource;
+        }
+        void set_resource(memory_resource* r) noexcept
+        {
+            SCN_EXPECT(r);
+            m_resource = r;
+        }
+
+        /**
+         * If `true`, the source is known to contain valid values, and
+         * scanners may use faster kernels that skip validation, like
+         * overflow checks. Bounds are still checked.
+         *
+         * Set by the `_unchecked` family of scanning functions.
+         */
+        constexpr bool trusted() const noexcept
+        {
+            return m_trusted;
+        }
+        void set_trusted(bool t) noexcept
+        {
+            m_trusted = t;
+        }
+
     private:
         range_type m_range;
         locale_type m_locale{};
+        memory_resource* m_resource{get_default_resource()};
+        bool m_trusted{false};
     };
 
     template <typename WrappedRange,
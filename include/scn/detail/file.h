@@ -19,7 +19,9 @@
 #define SCN_DETAIL_FILE_H
 
 #include <cstdio>
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "../util/algorithm.h"
 #include "range.h"
@@ -175,6 +177,15 @@ namespace scn {
     /**
      * Range mapping to a C FILE*.
      * Not copyable or reconstructible.
+     *
+     * Scanning a `string_view` from a file pins the read buffer the view
+     * points into (see `pin_segment()`). Once pinned, a buffer isn't reused
+     * or freed when the file reads more, or on `sync()`: it's retired, and
+     * retired buffers build up until `release_pinned()` is called, or the
+     * file is destroyed.
+     * When scanning many `string_view`s from a long-lived file, call
+     * `release_pinned()` once they're no longer used, so that memory use
+     * doesn't grow with everything read.
      */
     template <typename CharT>
     class basic_file {
@@ -297,6 +308,9 @@ namespace scn {
 
         basic_file(basic_file&& o) noexcept
             : m_buffer(detail::exchange(o.m_buffer, {})),
+              m_retired(SCN_MOVE(o.m_retired)),
+              m_buffer_pinned(detail::exchange(o.m_buffer_pinned, false)),
+              m_dropped(detail::exchange(o.m_dropped, size_t{0})),
               m_file(detail::exchange(o.m_file, nullptr))
         {
         }
@@ -306,6 +320,9 @@ namespace scn {
                 sync();
             }
             m_buffer = detail::exchange(o.m_buffer, {});
+            m_retired = SCN_MOVE(o.m_retired);
+            m_buffer_pinned = detail::exchange(o.m_buffer_pinned, false);
+            m_dropped = detail::exchange(o.m_dropped, size_t{0});
             m_file = detail::exchange(o.m_file, nullptr);
             return *this;
         }
@@ -375,12 +392,13 @@ namespace scn {
         void sync() noexcept
         {
             _sync_all();
-            m_buffer.clear();
+            _replace_buffer({});
+            m_dropped = 0;
         }
 
         iterator begin() const noexcept
         {
-            return {*this, 0};
+            return {*this, m_dropped};
         }
         sentinel end() const noexcept
         {
@@ -401,6 +419,143 @@ namespace scn {
             return {begin, begin + static_cast<std::ptrdiff_t>(end_diff)};
         }
 
+        /**
+         * Keeps the part of the read buffer of the file `s` points into in
+         * place, and returns a view to it.
+         * `s` must have been returned by `get_buffer()`.
+         *
+         * The read buffer of the file would otherwise move as it grows, or
+         * be reused after `sync()`. Instead, a pinned buffer is kept alive
+         * until `release_pinned()` is called, or the file is destroyed.
+         * Scanning a `string_view` from a file uses this, so no characters
+         * are copied.
+         *
+         * \code{.cpp}
+         * scn::string_view word;
+         * auto result = scn::make_result(file);
+         * while ((result = scn::scan(result.range(), "{}", word))) {
+         *     // use word
+         * }
+         * file.release_pinned();
+         * \endcode
+         */
+        basic_string_view<CharT> pin_segment(span<const CharT> s) const
+        {
+            SCN_EXPECT(_in_buffer(s.data()) &&
+                       _in_buffer(s.data() + s.size()));
+            const auto offset =
+                static_cast<size_t>(s.data() - m_buffer.data());
+            if (_in_object(m_buffer.data())) {
+                // Short strings are stored inline, and would move along with
+                // the file: make sure the buffer is heap-allocated
+                m_buffer.reserve(m_buffer.capacity() + 1);
+            }
+            m_buffer_pinned = true;
+            return {m_buffer.data() + offset, s.size()};
+        }
+
+        /**
+         * Invalidates every view returned by `pin_segment()`, allowing the
+         * memory to be reused.
+         */
+        void release_pinned() noexcept
+        {
+            m_retired.clear();
+            m_buffer_pinned = false;
+        }
+
+        /**
+         * Reads characters directly from the underlying `FILE*`, a block at a
+         * time, and discards them, until `until` is found, or `n` characters
+         * have been read.
+         *
+         * `it` must point to the end of the data already read from the file.
+         * If found, `until` (and whatever was read after it) is kept, so that
+         * `it` points to it afterwards.
+         *
+         * If `keep` is `false`, the discarded characters are not kept in the
+         * buffer of the file, so they can't be put back.
+         * Otherwise, they're appended to the buffer like with regular
+         * reading, and `it` has to be advanced past them.
+         *
+         * \return The number of characters `it` needs to be advanced by to
+         * get to `until`, or `error::end_of_range` if EOF was reached before
+         * `until` was found.
+         */
+        expected<std::ptrdiff_t> discard_until(iterator it,
+                                               CharT until,
+                                               std::ptrdiff_t n,
+                                               bool keep) const;
+
+        /**
+         * Returns the buffered characters from `it` up to, and including,
+         * the next `until`, or up to EOF, if there's no `until`.
+         * The buffer is searched first, and then more is read from the file,
+         * a block at a time, like with `discard_until()`.
+         *
+         * The returned view is valid until more is read into the buffer.
+         * Returns `error::end_of_range`, if `it` is at EOF.
+         */
+        expected<span<const CharT>> buffer_until(iterator it,
+                                                 CharT until) const
+        {
+            SCN_EXPECT(it.m_file == this);
+            SCN_EXPECT(it.m_current <= m_buffer.size());
+            const auto start = it.m_current;
+            auto p = std::char_traits<CharT>::find(
+                m_buffer.data() + start, m_buffer.size() - start, until);
+            if (p) {
+                return span<const CharT>{m_buffer.data() + start, p + 1};
+            }
+
+            const auto buffered = m_buffer.size();
+            auto ret = discard_until(
+                {*this, buffered}, until,
+                std::numeric_limits<std::ptrdiff_t>::max(), true);
+            if (!ret) {
+                if (ret.error().code() != error::end_of_range) {
+                    return ret.error();
+                }
+                if (m_buffer.size() == start) {
+                    return ret.error();
+                }
+                return span<const CharT>{m_buffer.data() + start,
+                                         m_buffer.data() + m_buffer.size()};
+            }
+            const auto end = buffered + static_cast<size_t>(ret.value()) + 1;
+            return span<const CharT>{m_buffer.data() + start,
+                                     m_buffer.data() + end};
+        }
+
+        /**
+         * Removes the first `n` characters after `begin()` from the buffer
+         * of the file, so that they can no longer be put back.
+         * Keeps the memory use of the file constant, when reading it in a
+         * loop without calling `sync()`.
+         *
+         * The characters are only moved in the buffer once the dropped ones
+         * make up at least half of it, so that this is amortized constant
+         * time per character.
+         *
+         * Invalidates all iterators: `begin()` now points to where
+         * `begin() + n` did.
+         */
+        void drop_buffered(size_t n) const
+        {
+            SCN_EXPECT(m_dropped + n <= m_buffer.size());
+            m_dropped += n;
+            if (m_dropped < m_buffer.size() - m_dropped) {
+                return;
+            }
+            if (m_buffer_pinned) {
+                _replace_buffer(m_buffer.substr(m_dropped));
+            }
+            else {
+                m_buffer.erase(0, m_dropped);
+            }
+            m_dropped = 0;
+        }
+
     private:
         friend class iterator;
 
@@ -412,6 +567,51 @@ namespace scn {
         }
         void _sync_until(size_t pos) noexcept;
 
+        // Views returned by pin_segment() may point into the buffer:
+        // if so, the old buffer is kept alive, instead of being reallocated
+        // or overwritten.
+        void _reserve(size_t n) const
+        {
+            if (!m_buffer_pinned ||
+                m_buffer.capacity() - m_buffer.size() >= n) {
+                return;
+            }
+            std::basic_string<CharT> next;
+            next.reserve(detail::max(m_buffer.capacity() * 2,
+                                     m_buffer.size() + n));
+            next.append(m_buffer);
+            _replace_buffer(SCN_MOVE(next));
+        }
+        void _replace_buffer(std::basic_string<CharT> next) const
+        {
+            if (!m_buffer_pinned) {
+                if (next.empty()) {
+                    // keep the capacity around
+                    m_buffer.clear();
+                    return;
+                }
+                m_buffer = SCN_MOVE(next);
+                return;
+            }
+            m_retired.push_back(SCN_MOVE(m_buffer));
+            m_buffer = SCN_MOVE(next);
+            m_buffer_pinned = false;
+        }
+
+        bool _in_buffer(const CharT* p) const
+        {
+            return !std::less<const CharT*>{}(p, m_buffer.data()) &&
+                   !std::less<const CharT*>{}(m_buffer.data() + m_buffer.size(),
+                                              p);
+        }
+        bool _in_object(const CharT* p) const
+        {
+            const auto obj = reinterpret_cast<const char*>(&m_buffer);
+            const auto q = reinterpret_cast<const char*>(p);
+            return !std::less<const char*>{}(q, obj) &&
+                   std::less<const char*>{}(q, obj + sizeof(m_buffer));
+        }
+
         CharT _get_char_at(size_t i) const
         {
             SCN_EXPECT(valid());
@@ -426,6 +626,11 @@ namespace scn {
         }
 
         mutable std::basic_string<CharT> m_buffer{};
+        // Previous read buffers, with views from pin_segment() into them
+        mutable std::vector<std::basic_string<CharT>> m_retired{};
+        mutable bool m_buffer_pinned{false};
+        // Characters at the front of the buffer removed by drop_buffered()
+        mutable size_t m_dropped{0};
         FILE* m_file{nullptr};
     };
 
@@ -449,6 +654,16 @@ namespace scn {
     void file::_sync_until(size_t) noexcept;
     template <>
     void wfile::_sync_until(size_t) noexcept;
+    template <>
+    expected<std::ptrdiff_t> file::discard_until(file::iterator,
+                                                 char,
+                                                 std::ptrdiff_t,
+                                                 bool) const;
+    template <>
+    expected<std::ptrdiff_t> wfile::discard_until(wfile::iterator,
+                                                  wchar_t,
+                                                  std::ptrdiff_t,
+                                                  bool) const;
 
     /**
      * A child class for basic_file, handling fopen, fclose, and lifetimes with
@@ -158,6 +158,12 @@ namespace scn {
     template <typename T>
     class optional;
 
+    // util/memory_resource.h
+
+    class memory_resource;
+    template <typename T>
+    class polymorphic_allocator;
+
     // util/small_vector.h
 
     namespace detail {
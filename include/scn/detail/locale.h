@@ -106,6 +106,27 @@ namespace scn {
             return cp >= '0' && cp <= '9';
         }
 
+        /**
+         * Character classes, as in `std::ctype_base::mask`, but with fixed
+         * values, so that they can be stored in a lookup table.
+         * Every class gets its own bit, composite classes like `alnum`
+         * included, to mirror the locale exactly.
+         */
+        enum ctype_mask : uint16_t {
+            ctype_space = 1,
+            ctype_print = 2,
+            ctype_cntrl = 4,
+            ctype_upper = 8,
+            ctype_lower = 16,
+            ctype_alpha = 32,
+            ctype_digit = 64,
+            ctype_punct = 128,
+            ctype_xdigit = 256,
+            ctype_blank = 512,
+            ctype_alnum = 1024,
+            ctype_graph = 2048,
+        };
+
         template <typename CharT>
         struct locale_defaults;
         template <>
@@ -411,10 +432,60 @@ namespace scn {
             expected<wchar_t> convert_to_wide(const CharT* from_begin,
                                               const CharT* from_end) const;
 
-#define SCN_DEFINE_CUSTOM_LOCALE_CTYPE(f)     \
-    bool is_##f(char_type) const;             \
-    bool is_##f(span<const char_type>) const; \
-    bool is_##f(code_point) const;
+            /**
+             * Returns `true`, if `ch` belongs to any of the character classes
+             * in `mask`, which is a combination of `ctype_mask` bits.
+             *
+             * Code units below 256 are classified with a table, captured from
+             * the locale on construction, so that no facet lookup or virtual
+             * call is done.
+             */
+            bool is_ctype(uint16_t mask, char_type ch) const
+            {
+                const auto i = static_cast<size_t>(
+                    static_cast<typename std::make_unsigned<char_type>::type>(
+                        ch));
+                if (SCN_LIKELY(i < 256)) {
+                    SCN_EXPECT(m_ctype_table);
+                    return (m_ctype_table[i] & mask) != 0;
+                }
+                return _is_ctype_wide(mask, make_code_point(ch));
+            }
+            /// \copydoc is_ctype(uint16_t, char_type) const
+            bool is_ctype(uint16_t mask, code_point cp) const
+            {
+                // For narrow characters, only ASCII is safe to look up from
+                // the table: the rest are multibyte code points
+                const auto i = static_cast<size_t>(cp);
+                if (SCN_LIKELY(i < (sizeof(char_type) == 1 ? 0x80u : 0x100u))) {
+                    SCN_EXPECT(m_ctype_table);
+                    return (m_ctype_table[i] & mask) != 0;
+                }
+                return _is_ctype_wide(mask, cp);
+            }
+            /// \copydoc is_ctype(uint16_t, char_type) const
+            bool is_ctype(uint16_t mask, span<const char_type> ch) const
+            {
+                SCN_EXPECT(ch.size() >= 1);
+                if (SCN_LIKELY(ch.size() == 1)) {
+                    return is_ctype(mask, ch[0]);
+                }
+                return _is_ctype_multibyte(mask, ch);
+            }
+
+#define SCN_DEFINE_CUSTOM_LOCALE_CTYPE(f)                 \
+    bool is_##f(char_type ch) const                       \
+    {                                                     \
+        return is_ctype(ctype_##f, ch);                   \
+    }                                                     \
+    bool is_##f(span<const char_type> ch) const           \
+    {                                                     \
+        return is_ctype(ctype_##f, ch);                   \
+    }                                                     \
+    bool is_##f(code_point cp) const                      \
+    {                                                     \
+        return is_ctype(ctype_##f, cp);                   \
+    }
             SCN_DEFINE_CUSTOM_LOCALE_CTYPE(alnum)
             SCN_DEFINE_CUSTOM_LOCALE_CTYPE(alpha)
             SCN_DEFINE_CUSTOM_LOCALE_CTYPE(blank)
@@ -427,10 +498,16 @@ namespace scn {
             SCN_DEFINE_CUSTOM_LOCALE_CTYPE(xdigit)
 #undef SCN_DEFINE_CUSTOM_LOCALE_CTYPE
 
-            bool is_space(code_point) const;
+            bool is_space(code_point cp) const
+            {
+                return is_ctype(ctype_space, cp);
+            }
             using base::is_space;
 
-            bool is_digit(code_point) const;
+            bool is_digit(code_point cp) const
+            {
+                return is_ctype(ctype_digit, cp);
+            }
             using base::is_digit;
 
             template <typename T>
@@ -454,8 +531,14 @@ namespace scn {
 
             void _initialize();
 
+            bool _is_ctype_wide(uint16_t mask, code_point cp) const;
+            bool _is_ctype_multibyte(uint16_t mask,
+                                     span<const char_type> ch) const;
+
             const void* m_locale{nullptr};
             void* m_data{nullptr};
+            // Points into m_data, 256 entries
+            const uint16_t* m_ctype_table{nullptr};
         };
     }  // namespace detail
 
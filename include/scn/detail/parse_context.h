@@ -107,6 +107,29 @@ namespace scn {
             }
             return false;
         }
+        /**
+         * Returns the run of literal characters starting from `next_char()`,
+         * up until the next brace or whitespace character, or the end of the
+         * format string.
+         *
+         * To be called after `should_read_literal()` returned `true`:
+         * `next_char()` is always a part of the run, even if it's a brace.
+         * The run can then be matched against the source range all at once,
+         * and skipped over with `advance_char(run.size())`.
+         */
+        SCN_NODISCARD SCN_CONSTEXPR14 string_view_type literal_run() const
+        {
+            SCN_EXPECT(good());
+            auto it = m_str.begin() + 1;
+            for (; it != m_str.end(); ++it) {
+                if (*it == detail::ascii_widen<char_type>('{') ||
+                    *it == detail::ascii_widen<char_type>('}') ||
+                    m_locale.get_static().is_space(*it)) {
+                    break;
+                }
+            }
+            return {m_str.data(), static_cast<size_t>(it - m_str.begin())};
+        }
         /**
          * Returns `true` if `ch` is equal to `next_char()`
          */
@@ -402,6 +425,10 @@ namespace scn {
         {
             return false;
         }
+        constexpr string_view_type literal_run() const
+        {
+            return {};
+        }
         constexpr bool check_literal(char_type) const
         {
             return false;
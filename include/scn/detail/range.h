@@ -21,6 +21,7 @@
 #include "../ranges/ranges.h"
 #include "../util/algorithm.h"
 #include "../util/memory.h"
+#include "../util/stats.h"
 #include "error.h"
 #include "vectored.h"
 
@@ -320,7 +321,7 @@ namespace scn {
              * Note that `range_underlying().begin()` may not be equal to
              * `begin()`.
              */
-            const range_type& range_underlying() const noexcept
+            const range_nocvref_type& range_underlying() const noexcept
             {
                 return m_range.get();
             }
@@ -375,6 +376,52 @@ namespace scn {
                 return buf;
             }
 
+            /**
+             * Copies `s` into storage owned by the underlying range, which
+             * stays valid after `s` itself has been invalidated.
+             *
+             * \see basic_file::pin_segment()
+             */
+            template <typename R = range_nocvref_type,
+                      typename std::enable_if<provides_pinned_segments_impl<
+                          R,
+                          char_type>::value>::type* = nullptr>
+            basic_string_view<char_type> pin_segment(
+                span<const char_type> s) const
+            {
+                return m_range.get().pin_segment(s);
+            }
+
+            /**
+             * Discards characters from the underlying range until `ch` is
+             * found, or `n` characters have been discarded.
+             * `begin()` must be at the end of the data buffered by the
+             * underlying range.
+             *
+             * If there's no rollback point to go back to, the discarded
+             * characters aren't buffered.
+             * Otherwise, they're kept, and `begin()` is advanced past them,
+             * so that `reset_to_rollback_point()` still works.
+             *
+             * Returns `error::end_of_range`, if `ch` wasn't found.
+             *
+             * \see basic_file::discard_until()
+             */
+            template <typename R = range_nocvref_type,
+                      typename std::enable_if<provides_discard_until_impl<
+                          R,
+                          char_type>::value>::type* = nullptr>
+            error discard_until(char_type ch, std::ptrdiff_t n)
+            {
+                auto ret =
+                    m_range.get().discard_until(begin(), ch, n, m_read != 0);
+                if (!ret) {
+                    return ret.error();
+                }
+                advance(ret.value());
+                return {};
+            }
+
             /**
              * Reset `begin()` to the rollback point, as if by repeatedly
              * calling `operator--()` on the begin iterator.
@@ -385,6 +432,9 @@ namespace scn {
              */
             error reset_to_rollback_point()
             {
+                if (m_read != 0) {
+                    SCN_STATS_ADD(rollbacks, 1);
+                }
                 for (; m_read != 0; --m_read) {
                     --m_begin;
                     if (m_begin == end()) {
@@ -403,6 +453,13 @@ namespace scn {
             {
                 m_read = 0;
             }
+            /**
+             * Number of characters read since the rollback point.
+             */
+            difference_type distance_from_rollback_point() const noexcept
+            {
+                return m_read;
+            }
 
             void reset_begin_iterator()
             {
@@ -441,6 +498,28 @@ namespace scn {
              */
             static constexpr bool provides_buffer_access =
                 provides_buffer_access_impl<range_nocvref_type>::value;
+            /**
+             * `true` if the range can keep copies of its contents alive
+             * for the caller (`pin_segment()`), so that views can be
+             * scanned from it even if it's not contiguous.
+             */
+            static constexpr bool provides_pinned_segments =
+                provides_pinned_segments_impl<range_nocvref_type,
+                                              char_type>::value;
+            /**
+             * `true` if the range can skip over its contents a block at a
+             * time, without buffering them (`discard_until()`).
+             */
+            static constexpr bool provides_discard_until =
+                provides_discard_until_impl<range_nocvref_type,
+                                            char_type>::value;
+            /**
+             * `true` if the buffers returned by `detail::get_buffer()` point
+             * into memory that stays valid as long as the underlying range,
+             * so that views into them can be returned from scanning.
+             */
+            static constexpr bool provides_stable_buffer =
+                provides_stable_buffer_impl<range_nocvref_type>::value;
 
         private:
             template <typename R = Range>
@@ -0,0 +1,389 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_DETAIL_SEGMENTED_H
+#define SCN_DETAIL_SEGMENTED_H
+
+#include "range.h"
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    /**
+     * Range over a chain of non-contiguous buffer segments, like an `iovec`
+     * array, or the buffers of a rope, read in order as if they were a single
+     * range.
+     *
+     * Doesn't own or copy the segments, or the array of segments: both must
+     * outlive this object.
+     * Empty segments are allowed, and skipped over.
+     *
+     * The iterator keeps track of the segment it points into, so that getting
+     * the contiguous buffer it points into (`get_buffer()`) is constant time.
+     * Values that fit in a single segment are read directly from it.
+     * When scanning a `string_view`, a value fully inside a segment points
+     * into it, and a value straddling a segment boundary is copied into
+     * storage owned by this object (`pin_segment()`).
+     *
+     * Not copyable, like `basic_file`: pass it in as an lvalue.
+     *
+     * \code{.cpp}
+     * std::vector<scn::span<const char>> chain = receive();
+     * scn::segmented_range r{scn::make_span(chain).as_const()};
+     * int id;
+     * scn::string_view name;
+     * auto ret = scn::scan(r, "{} {}", id, name);
+     * // ret.range().begin().position() is the number of characters consumed
+     * \endcode
+     */
+    template <typename CharT>
+    class basic_segmented_range {
+    public:
+        using char_type = CharT;
+        using segment_type = span<const CharT>;
+
+        class iterator {
+        public:
+            using value_type = CharT;
+            using reference = const CharT&;
+            using pointer = const CharT*;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::random_access_iterator_tag;
+
+            iterator() = default;
+
+            reference operator*() const noexcept
+            {
+                SCN_EXPECT(m_ptr);
+                return *m_ptr;
+            }
+            pointer operator->() const noexcept
+            {
+                return m_ptr;
+            }
+            reference operator[](difference_type n) const noexcept
+            {
+                return *(*this + n);
+            }
+
+            iterator& operator++() noexcept
+            {
+                SCN_EXPECT(m_ptr);
+                ++m_ptr;
+                ++m_position;
+                if (m_ptr == _segment().end()) {
+                    _next_segment();
+                }
+                return *this;
+            }
+            iterator operator++(int) noexcept
+            {
+                auto tmp = *this;
+                operator++();
+                return tmp;
+            }
+
+            iterator& operator--() noexcept
+            {
+                SCN_EXPECT(m_position > 0);
+                if (!m_ptr || m_ptr == _segment().begin()) {
+                    _prev_segment();
+                    m_ptr = _segment().end();
+                }
+                --m_ptr;
+                --m_position;
+                return *this;
+            }
+            iterator operator--(int) noexcept
+            {
+                auto tmp = *this;
+                operator--();
+                return tmp;
+            }
+
+            /**
+             * Advances by `n` characters.
+             * Linear in the number of segments skipped over, instead of
+             * characters.
+             */
+            iterator& operator+=(difference_type n) noexcept
+            {
+                if (n > 0) {
+                    _forward(static_cast<size_t>(n));
+                }
+                else if (n < 0) {
+                    _backward(static_cast<size_t>(-n));
+                }
+                return *this;
+            }
+            iterator& operator-=(difference_type n) noexcept
+            {
+                return operator+=(-n);
+            }
+
+            friend iterator operator+(iterator it, difference_type n) noexcept
+            {
+                return it += n;
+            }
+            friend iterator operator+(difference_type n, iterator it) noexcept
+            {
+                return it += n;
+            }
+            friend iterator operator-(iterator it, difference_type n) noexcept
+            {
+                return it -= n;
+            }
+            friend difference_type operator-(const iterator& a,
+                                             const iterator& b) noexcept
+            {
+                return static_cast<difference_type>(a.m_position) -
+                       static_cast<difference_type>(b.m_position);
+            }
+
+            bool operator==(const iterator& o) const noexcept
+            {
+                return m_position == o.m_position;
+            }
+            bool operator!=(const iterator& o) const noexcept
+            {
+                return !operator==(o);
+            }
+            bool operator<(const iterator& o) const noexcept
+            {
+                return m_position < o.m_position;
+            }
+            bool operator>(const iterator& o) const noexcept
+            {
+                return o.operator<(*this);
+            }
+            bool operator<=(const iterator& o) const noexcept
+            {
+                return !operator>(o);
+            }
+            bool operator>=(const iterator& o) const noexcept
+            {
+                return !operator<(o);
+            }
+
+            /// Offset of this iterator from the beginning of the range
+            size_t position() const noexcept
+            {
+                return m_position;
+            }
+            /**
+             * Index of the segment this iterator points into, or the number
+             * of segments, if this is the end iterator
+             */
+            size_t segment_index() const noexcept
+            {
+                return m_segment;
+            }
+
+        private:
+            friend class basic_segmented_range;
+
+            iterator(const basic_segmented_range& r,
+                     size_t segment,
+                     size_t position) noexcept
+                : m_range(std::addressof(r)),
+                  m_segment(segment),
+                  m_position(position)
+            {
+                if (m_segment < _segments().size()) {
+                    m_ptr = _segment().data();
+                    if (_segment().size() == 0) {
+                        _next_segment();
+                    }
+                }
+            }
+
+            span<const segment_type> _segments() const noexcept
+            {
+                return m_range->m_segments;
+            }
+            const segment_type& _segment() const noexcept
+            {
+                return _segments()[m_segment];
+            }
+
+            // Moves to the beginning of the next non-empty segment,
+            // or to the end
+            void _next_segment() noexcept
+            {
+                do {
+                    ++m_segment;
+                } while (m_segment < _segments().size() &&
+                         _segment().size() == 0);
+                m_ptr = m_segment < _segments().size() ? _segment().data()
+                                                       : nullptr;
+            }
+            // Moves to the previous non-empty segment, without setting m_ptr
+            void _prev_segment() noexcept
+            {
+                do {
+                    SCN_EXPECT(m_segment > 0);
+                    --m_segment;
+                } while (_segment().size() == 0);
+            }
+
+            void _forward(size_t n) noexcept
+            {
+                while (n != 0) {
+                    SCN_EXPECT(m_ptr);
+                    const auto left =
+                        static_cast<size_t>(_segment().end() - m_ptr);
+                    if (n < left) {
+                        m_ptr += n;
+                        m_position += n;
+                        return;
+                    }
+                    m_position += left;
+                    n -= left;
+                    _next_segment();
+                }
+            }
+            void _backward(size_t n) noexcept
+            {
+                SCN_EXPECT(n <= m_position);
+                while (n != 0) {
+                    if (!m_ptr || m_ptr == _segment().begin()) {
+                        _prev_segment();
+                        m_ptr = _segment().end();
+                    }
+                    const auto avail =
+                        static_cast<size_t>(m_ptr - _segment().begin());
+                    const auto step = n < avail ? n : avail;
+                    m_ptr -= step;
+                    m_position -= step;
+                    n -= step;
+                }
+            }
+
+            const basic_segmented_range* m_range{nullptr};
+            const CharT* m_ptr{nullptr};
+            size_t m_segment{0};
+            size_t m_position{0};
+        };
+        using sentinel = iterator;
+
+        /**
+         * Values scanned as views may point into the segments, which stay
+         * valid as long as this object.
+         *
+         * \see detail::provides_stable_buffer_impl
+         */
+        static constexpr bool stable_buffer_access = true;
+
+        basic_segmented_range() = default;
+        /**
+         * \param segments Segments to read from, in order.
+         * Not copied: must outlive this object.
+         */
+        explicit basic_segmented_range(span<const segment_type> segments)
+            : m_segments(segments)
+        {
+            for (auto& s : m_segments) {
+                m_size += s.size();
+            }
+        }
+
+        basic_segmented_range(const basic_segmented_range&) = delete;
+        basic_segmented_range& operator=(const basic_segmented_range&) =
+            delete;
+
+        basic_segmented_range(basic_segmented_range&&) noexcept = default;
+        basic_segmented_range& operator=(basic_segmented_range&&) noexcept =
+            default;
+
+        ~basic_segmented_range() = default;
+
+        iterator begin() const noexcept
+        {
+            return {*this, 0, 0};
+        }
+        sentinel end() const noexcept
+        {
+            return {*this, m_segments.size(), m_size};
+        }
+
+        /// Total number of characters in all of the segments
+        size_t size() const noexcept
+        {
+            return m_size;
+        }
+        bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        span<const segment_type> segments() const noexcept
+        {
+            return m_segments;
+        }
+
+        /**
+         * Returns the rest of the segment `it` points into, up to `max_size`
+         * characters. Constant time.
+         */
+        span<const CharT> get_buffer(iterator it,
+                                     size_t max_size) const noexcept
+        {
+            if (!it.m_ptr) {
+                return {};
+            }
+            const auto end = it._segment().end();
+            const auto size = detail::min(
+                max_size, static_cast<size_t>(end - it.m_ptr));
+            return {it.m_ptr, size};
+        }
+
+        /**
+         * Copies `s` into storage owned by this object, and returns a view
+         * to it.
+         * The view is valid until `release_pinned()` is called, or this object
+         * is destroyed.
+         * Used for scanning a `string_view` straddling a segment boundary.
+         *
+         * \see basic_file::pin_segment()
+         */
+        basic_string_view<CharT> pin_segment(span<const CharT> s) const
+        {
+            return m_pinned.pin(s);
+        }
+
+        /**
+         * Invalidates every view returned by `pin_segment()`, allowing the
+         * memory to be reused.
+         */
+        void release_pinned() noexcept
+        {
+            m_pinned.release();
+        }
+
+    private:
+        span<const segment_type> m_segments{};
+        size_t m_size{0};
+        mutable detail::basic_pinned_segments<CharT> m_pinned{};
+    };
+
+    using segmented_range = basic_segmented_range<char>;
+    using wsegmented_range = basic_segmented_range<wchar_t>;
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#endif  // SCN_DETAIL_SEGMENTED_H
@@ -19,7 +19,11 @@
 #define SCN_DETAIL_VECTORED_H
 
 #include "../ranges/util.h"
+#include "../util/algorithm.h"
 #include "../util/math.h"
+#include "../util/string_view.h"
+
+#include <vector>
 
 namespace scn {
     SCN_BEGIN_NAMESPACE
@@ -36,6 +40,9 @@ namespace scn {
                                              ranges::distance(begin, end)));
                 }
 
+                // Linear in the number of segments, as the segment `begin`
+                // points into has to be searched for:
+                // basic_segmented_range keeps track of it in its iterator
                 template <typename CharT>
                 static SCN_CONSTEXPR14
                     span<typename std::add_const<CharT>::type>
@@ -157,6 +164,111 @@ namespace scn {
                       provides_buffer_access_concept,
                       Range,
                       ::scn::ranges::iterator_t<const Range>>::value> {};
+
+        struct provides_pinned_segments_concept {
+            template <typename Range, typename CharT>
+            auto _test_requires(const Range& r, span<const CharT> s)
+                -> decltype(scn::detail::valid_expr(r.pin_segment(s)));
+        };
+        template <typename Range, typename CharT>
+        struct provides_pinned_segments_impl
+            : std::integral_constant<
+                  bool,
+                  ::scn::custom_ranges::detail::_requires<
+                      provides_pinned_segments_concept,
+                      Range,
+                      CharT>::value> {};
+
+        struct provides_discard_until_concept {
+            template <typename Range, typename CharT>
+            auto _test_requires(const Range& r, CharT ch)
+                -> decltype(scn::detail::valid_expr(
+                    r.discard_until(::scn::ranges::begin(r), ch, 0, false)));
+        };
+        template <typename Range, typename CharT>
+        struct provides_discard_until_impl
+            : std::integral_constant<
+                  bool,
+                  ::scn::custom_ranges::detail::_requires<
+                      provides_discard_until_concept,
+                      Range,
+                      CharT>::value> {};
+
+        template <typename Range, typename = void>
+        struct provides_stable_buffer_impl : std::false_type {
+        };
+        template <typename Range>
+        struct provides_stable_buffer_impl<
+            Range,
+            void_t<decltype(Range::stable_buffer_access)>>
+            : std::integral_constant<bool, Range::stable_buffer_access> {
+        };
+
+        /**
+         * Storage for pinned buffer segments.
+         * Views returned by `pin()` stay valid until `release()` is called,
+         * or the storage is destroyed.
+         */
+        template <typename CharT>
+        class basic_pinned_segments {
+        public:
+            basic_string_view<CharT> pin(span<const CharT> s)
+            {
+                if (m_current == m_segments.size() ||
+                    _room(m_segments[m_current]) < s.size()) {
+                    _next_segment(s.size());
+                }
+                auto& seg = m_segments[m_current];
+                const auto offset = seg.size();
+                seg.insert(seg.end(), s.begin(), s.end());
+                return {seg.data() + offset, s.size()};
+            }
+
+            /**
+             * Invalidates every view returned by `pin()`.
+             * The first segment is kept around for reuse.
+             */
+            void release() noexcept
+            {
+                if (m_segments.size() > 1) {
+                    m_segments.erase(m_segments.begin() + 1, m_segments.end());
+                }
+                if (!m_segments.empty()) {
+                    m_segments.front().clear();
+                }
+                m_current = 0;
+            }
+
+        private:
+            static constexpr size_t segment_size = 4096 / sizeof(CharT);
+
+            static size_t _room(const std::vector<CharT>& seg)
+            {
+                return seg.capacity() - seg.size();
+            }
+
+            void _next_segment(size_t min_size)
+            {
+                if (m_current < m_segments.size()) {
+                    ++m_current;
+                }
+                if (m_current < m_segments.size() &&
+                    _room(m_segments[m_current]) >= min_size) {
+                    return;
+                }
+                // Only the reserved capacity is ever used, so the data of
+                // a segment never moves
+                std::vector<CharT> seg;
+                seg.reserve(max(segment_size, min_size));
+                m_segments.insert(
+                    m_segments.begin() +
+                        static_cast<std::ptrdiff_t>(m_current),
+                    SCN_MOVE(seg));
+            }
+
+            std::vector<std::vector<CharT>> m_segments{};
+            size_t m_current{0};
+        };
     }  // namespace detail
 
     SCN_END_NAMESPACE
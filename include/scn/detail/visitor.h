@@ -115,6 +115,91 @@ namespace scn {
         ParseCtx* m_pctx;
     };
 
+    namespace detail {
+        /**
+         * Matches the literal characters in `lit` against the beginning of
+         * `r`, a buffer at a time, with `std::char_traits::compare`
+         * (`memcmp`/`wmemcmp`). A contiguous range is a single buffer, so
+         * it's compared all at once.
+         *
+         * On mismatch, `r` is left at an unspecified position, and has to be
+         * rolled back by the caller.
+         */
+        template <typename WrappedRange>
+        error match_literal_run(
+            WrappedRange& r,
+            span<const typename WrappedRange::char_type> lit)
+        {
+            using traits = std::char_traits<typename WrappedRange::char_type>;
+            while (lit.size() != 0) {
+                auto buf = r.get_buffer_and_advance(lit.size());
+                bool match = true;
+                if (buf.size() == 0) {
+                    // No buffer available at this position
+                    auto cu = read_code_unit(r);
+                    if (!cu) {
+                        return cu.error();
+                    }
+                    match = cu.value() == lit[0];
+                    lit = lit.subspan(1);
+                }
+                else {
+                    match = traits::compare(buf.data(), lit.data(),
+                                            buf.size()) == 0;
+                    lit = lit.subspan(buf.size());
+                }
+                if (!match) {
+                    return {error::invalid_scanned_value,
+                            "Expected character from format string not "
+                            "found in the stream"};
+                }
+            }
+            return {};
+        }
+
+        template <typename Context, typename ParseCtx>
+        error read_literal(Context& ctx, ParseCtx& pctx, std::false_type)
+        {
+            // Check for any non-specifier {foo} characters
+            alignas(typename Context::char_type) unsigned char buf[4] = {0};
+            SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
+            auto ret = read_code_point(ctx.range(), make_span(buf, 4));
+            SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
+            if (!ret) {
+                return ret.error();
+            }
+            if (!pctx.check_literal(ret.value().chars)) {
+                // Mismatching characters in scan string and stream
+                return {error::invalid_scanned_value,
+                        "Expected character from format string not "
+                        "found in the stream"};
+            }
+            // Bump pctx to next char
+            if (!pctx.advance_cp()) {
+                pctx.advance_char();
+            }
+            return {};
+        }
+
+        // Literal runs longer than a single character are matched all at
+        // once, if the range provides buffer access
+        template <typename Context, typename ParseCtx>
+        error read_literal(Context& ctx, ParseCtx& pctx, std::true_type)
+        {
+            const auto run = pctx.literal_run();
+            if (run.size() == 1) {
+                return read_literal(ctx, pctx, std::false_type{});
+            }
+            auto ret = match_literal_run(ctx.range(),
+                                         make_span(run.data(), run.size()));
+            if (!ret) {
+                return ret;
+            }
+            pctx.advance_char(static_cast<std::ptrdiff_t>(run.size()));
+            return {};
+        }
+    }  // namespace detail
+
     template <typename Context, typename ParseCtx>
     error visit(Context& ctx,
                 ParseCtx& pctx,
@@ -135,6 +220,7 @@ namespace scn {
                     }
                     SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
                     auto rb = ctx.range().reset_to_rollback_point();
+                    SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
                     if (!rb) {
                         return rb;
                     }
@@ -151,29 +237,17 @@ namespace scn {
                     return {error::invalid_format_string,
                             "Unexpected end of format string"};
                 }
-                // Check for any non-specifier {foo} characters
-                alignas(typename Context::char_type) unsigned char buf[4] = {0};
-                auto ret = read_code_point(ctx.range(), make_span(buf, 4));
-                SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
-                if (!ret || !pctx.check_literal(ret.value().chars)) {
+                auto ret = detail::read_literal(
+                    ctx, pctx,
+                    std::integral_constant<
+                        bool, Context::range_type::provides_buffer_access>{});
+                if (!ret) {
                     auto rb = ctx.range().reset_to_rollback_point();
                     if (!rb) {
                         // Failed rollback
                         return rb;
                     }
-                    if (!ret) {
-                        // Failed read
-                        return ret.error();
-                    }
-
-                    // Mismatching characters in scan string and stream
-                    return {error::invalid_scanned_value,
-                            "Expected character from format string not "
-                            "found in the stream"};
-                }
-                // Bump pctx to next char
-                if (!pctx.advance_cp()) {
-                    pctx.advance_char();
+                    return ret;
                 }
             }
             else {
@@ -214,8 +288,17 @@ namespace scn {
                     return {error::invalid_format_string,
                             "Unexpected end of format argument"};
                 }
+#if SCN_ENABLE_STATS
+                const auto read_before =
+                    ctx.range().distance_from_rollback_point();
+#endif
                 auto ret = visit_arg<char_type>(
                     basic_visitor<Context, ParseCtx>(ctx, pctx), arg);
+#if SCN_ENABLE_STATS
+                SCN_STATS_ADD(chars_read[static_cast<size_t>(arg.type())],
+                              ctx.range().distance_from_rollback_point() -
+                                  read_before);
+#endif
                 if (!ret) {
                     auto rb = ctx.range().reset_to_rollback_point();
                     if (!rb) {
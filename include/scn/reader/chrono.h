@@ -0,0 +1,971 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_READER_CHRONO_H
+#define SCN_READER_CHRONO_H
+
+#include "../detail/visitor.h"
+#include "../util/swar.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    namespace detail {
+        /**
+         * Broken-down time, as read by `time_parser`, before it's converted
+         * into the type being scanned.
+         */
+        struct time_fields {
+            int year{1970};
+            int month{1};
+            int day{1};
+            int hour{0};
+            int minute{0};
+            int second{0};
+            long nanosecond{0};
+            // 1-based, if `yday_set`
+            int yday{0};
+            // seconds east of UTC
+            int utc_offset{0};
+
+            enum flags_type : uint8_t {
+                month_or_day_set = 1,
+                yday_set = 2,
+                hour12 = 4,
+                pm = 8,
+            };
+            uint8_t flags{0};
+        };
+
+        SCN_CONSTEXPR14 bool is_leap_year(int y) noexcept
+        {
+            return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+        }
+        SCN_CONSTEXPR14 int days_in_month(int y, int m) noexcept
+        {
+            return m == 2 ? (is_leap_year(y) ? 29 : 28)
+                          : (m == 4 || m == 6 || m == 9 || m == 11 ? 30 : 31);
+        }
+
+        // Days since 1970-01-01 in the proleptic Gregorian calendar
+        SCN_CONSTEXPR14 long long days_from_civil(int y, int m, int d) noexcept
+        {
+            y -= m <= 2 ? 1 : 0;
+            const long long era = (y >= 0 ? y : y - 399) / 400;
+            const auto yoe = static_cast<long long>(y) - era * 400;
+            const long long doy =
+                (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+            const long long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+            return era * 146097 + doe - 719468;
+        }
+
+        /**
+         * Validates `f`, and resolves 12-hour clock hours, and dates given
+         * only as a day of the year.
+         */
+        inline error finish_time_fields(time_fields& f) noexcept
+        {
+            if ((f.flags & time_fields::hour12) != 0) {
+                if (f.hour < 1 || f.hour > 12) {
+                    return {error::value_out_of_range,
+                            "Time value out of range"};
+                }
+                f.hour = f.hour % 12 +
+                         ((f.flags & time_fields::pm) != 0 ? 12 : 0);
+            }
+            if ((f.flags & time_fields::yday_set) != 0 &&
+                (f.flags & time_fields::month_or_day_set) == 0) {
+                if (f.yday < 1 || f.yday > (is_leap_year(f.year) ? 366 : 365)) {
+                    return {error::value_out_of_range,
+                            "Time value out of range"};
+                }
+                int d = f.yday;
+                f.month = 1;
+                while (d > days_in_month(f.year, f.month)) {
+                    d -= days_in_month(f.year, f.month);
+                    ++f.month;
+                }
+                f.day = d;
+            }
+            if (f.month < 1 || f.month > 12 || f.day < 1 ||
+                f.day > days_in_month(f.year, f.month) || f.hour > 23 ||
+                f.minute > 59 || f.second > 60) {
+                return {error::value_out_of_range, "Time value out of range"};
+            }
+            return {};
+        }
+
+        /**
+         * Reads a timestamp directly from a contiguous range, through a
+         * pointer.
+         */
+        template <typename CharT>
+        class time_span_cursor {
+        public:
+            using char_type = CharT;
+
+            time_span_cursor(const CharT* b, const CharT* e) noexcept
+                : m_begin(b), m_it(b), m_end(e)
+            {
+            }
+
+            bool peek(CharT& ch) const noexcept
+            {
+                if (m_it == m_end) {
+                    return false;
+                }
+                ch = *m_it;
+                return true;
+            }
+            bool peek_next(CharT& ch) const noexcept
+            {
+                if (m_end - m_it < 2) {
+                    return false;
+                }
+                ch = *(m_it + 1);
+                return true;
+            }
+            void advance(std::ptrdiff_t n = 1) noexcept
+            {
+                m_it += n;
+            }
+
+            SCN_NODISCARD const CharT* data() const noexcept
+            {
+                return m_it;
+            }
+            SCN_NODISCARD std::ptrdiff_t size() const noexcept
+            {
+                return m_end - m_it;
+            }
+            SCN_NODISCARD std::ptrdiff_t consumed() const noexcept
+            {
+                return m_it - m_begin;
+            }
+            SCN_NODISCARD error source_error() const noexcept
+            {
+                return {};
+            }
+
+        private:
+            const CharT* m_begin;
+            const CharT* m_it;
+            const CharT* m_end;
+        };
+
+        /**
+         * Reads a timestamp from any range, a code unit at a time.
+         */
+        template <typename WrappedRange>
+        class time_range_cursor {
+        public:
+            using char_type = typename WrappedRange::char_type;
+
+            explicit time_range_cursor(WrappedRange& r) noexcept
+                : m_range(std::addressof(r))
+            {
+            }
+
+            bool peek(char_type& ch)
+            {
+                auto ret = read_code_unit(*m_range, false);
+                if (!ret) {
+                    if (ret.error() != error::end_of_range) {
+                        m_error = ret.error();
+                    }
+                    return false;
+                }
+                ch = ret.value();
+                return true;
+            }
+            bool peek_next(char_type& ch)
+            {
+                char_type tmp{};
+                if (!peek(tmp)) {
+                    return false;
+                }
+                m_range->advance();
+                const bool ret = peek(ch);
+                auto pb = putback_n(*m_range, 1);
+                if (!pb) {
+                    m_error = pb;
+                    return false;
+                }
+                return ret;
+            }
+            void advance(std::ptrdiff_t n = 1)
+            {
+                m_range->advance(n);
+                m_consumed += n;
+            }
+
+            SCN_NODISCARD std::ptrdiff_t consumed() const noexcept
+            {
+                return m_consumed;
+            }
+            SCN_NODISCARD error source_error() const noexcept
+            {
+                return m_error;
+            }
+
+        private:
+            WrappedRange* m_range;
+            std::ptrdiff_t m_consumed{0};
+            error m_error{};
+        };
+
+        template <typename CharT>
+        constexpr bool time_is_digit(CharT ch) noexcept
+        {
+            return ch >= ascii_widen<CharT>('0') &&
+                   ch <= ascii_widen<CharT>('9');
+        }
+
+        template <typename Cursor>
+        bool time_match(Cursor& c, char lit)
+        {
+            typename Cursor::char_type ch{};
+            if (!c.peek(ch) ||
+                ch != ascii_widen<typename Cursor::char_type>(lit)) {
+                return false;
+            }
+            c.advance();
+            return true;
+        }
+
+        template <typename Cursor>
+        void time_skip_space(Cursor& c)
+        {
+            typename Cursor::char_type ch{};
+            while (c.peek(ch) && is_space(ch)) {
+                c.advance();
+            }
+        }
+
+        // Reads between `min_digits` and `max_digits` digits
+        template <typename Cursor>
+        bool time_read_int(Cursor& c,
+                           int min_digits,
+                           int max_digits,
+                           int& out)
+        {
+            using char_type = typename Cursor::char_type;
+            char_type ch{};
+            int n = 0;
+            out = 0;
+            for (; n < max_digits && c.peek(ch) && time_is_digit(ch); ++n) {
+                out = out * 10 +
+                      static_cast<int>(ch - ascii_widen<char_type>('0'));
+                c.advance();
+            }
+            return n >= min_digits;
+        }
+
+        // Reads the digits of a decimal fraction, after the separator
+        template <typename Cursor>
+        bool time_read_fraction(Cursor& c, long& nanosecond)
+        {
+            using char_type = typename Cursor::char_type;
+            char_type ch{};
+            long scale = 100000000;
+            int n = 0;
+            nanosecond = 0;
+            for (; c.peek(ch) && time_is_digit(ch); ++n) {
+                nanosecond +=
+                    static_cast<long>(ch - ascii_widen<char_type>('0')) * scale;
+                scale /= 10;
+                c.advance();
+            }
+            return n != 0;
+        }
+
+        // `'.'` or `','`, followed by a digit
+        template <typename Cursor>
+        bool time_at_fraction(Cursor& c)
+        {
+            using char_type = typename Cursor::char_type;
+            char_type ch{};
+            return c.peek(ch) &&
+                   (ch == ascii_widen<char_type>('.') ||
+                    ch == ascii_widen<char_type>(',')) &&
+                   c.peek_next(ch) && time_is_digit(ch);
+        }
+
+        // "Z", "z", or [+-]hh[[:]mm]
+        template <typename Cursor>
+        bool time_read_utc_offset(Cursor& c, int& offset)
+        {
+            using char_type = typename Cursor::char_type;
+            char_type ch{};
+            if (!c.peek(ch)) {
+                return false;
+            }
+            if (ch == ascii_widen<char_type>('Z') ||
+                ch == ascii_widen<char_type>('z')) {
+                c.advance();
+                offset = 0;
+                return true;
+            }
+            const bool minus = ch == ascii_widen<char_type>('-');
+            if (!minus && ch != ascii_widen<char_type>('+')) {
+                return false;
+            }
+            c.advance();
+            int h{}, m{0};
+            if (!time_read_int(c, 2, 2, h)) {
+                return false;
+            }
+            time_match(c, ':');
+            if (c.peek(ch) && time_is_digit(ch) &&
+                !time_read_int(c, 2, 2, m)) {
+                return false;
+            }
+            if (h > 23 || m > 59) {
+                return false;
+            }
+            offset = (h * 3600 + m * 60) * (minus ? -1 : 1);
+            return true;
+        }
+
+        /**
+         * Reads an English name (of a month, a weekday, or AM/PM)
+         * case-insensitively, either in full or abbreviated to its first
+         * three letters.
+         * Sets `idx` to its index in `names`.
+         */
+        template <typename Cursor, size_t N>
+        bool time_read_name(Cursor& c,
+                            const char* const (&names)[N],
+                            int& idx)
+        {
+            using char_type = typename Cursor::char_type;
+            char buf[10] = {0};
+            size_t len = 0;
+            char_type ch{};
+            while (len < sizeof(buf) && c.peek(ch)) {
+                const auto lower = static_cast<char32_t>(ch) | 0x20u;
+                if (lower < U'a' || lower > U'z') {
+                    break;
+                }
+                buf[len++] = static_cast<char>(lower);
+                c.advance();
+            }
+            for (size_t i = 0; i < N; ++i) {
+                const auto n = std::strlen(names[i]);
+                if ((len == n || (len == 3 && n > 3)) &&
+                    std::memcmp(buf, names[i], len) == 0) {
+                    idx = static_cast<int>(i);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template <typename Cursor>
+        error time_parse_spec(Cursor& c,
+                              const char* spec,
+                              size_t spec_size,
+                              time_fields& f);
+
+        template <typename Cursor>
+        bool time_parse_conversion(Cursor& c, char conv, time_fields& f)
+        {
+            static const char* const months[] = {
+                "january", "february", "march",     "april",
+                "may",     "june",     "july",      "august",
+                "september", "october", "november", "december"};
+            static const char* const weekdays[] = {
+                "sunday",   "monday", "tuesday", "wednesday",
+                "thursday", "friday", "saturday"};
+
+            int tmp{};
+            switch (conv) {
+                case 'Y':
+                    return time_read_int(c, 1, 4, f.year);
+                case 'y':
+                    if (!time_read_int(c, 1, 2, tmp)) {
+                        return false;
+                    }
+                    f.year = tmp < 69 ? 2000 + tmp : 1900 + tmp;
+                    return true;
+                case 'm':
+                    f.flags |= time_fields::month_or_day_set;
+                    return time_read_int(c, 1, 2, f.month);
+                case 'e':
+                    time_skip_space(c);
+                    f.flags |= time_fields::month_or_day_set;
+                    return time_read_int(c, 1, 2, f.day);
+                case 'd':
+                    f.flags |= time_fields::month_or_day_set;
+                    return time_read_int(c, 1, 2, f.day);
+                case 'j':
+                    f.flags |= time_fields::yday_set;
+                    return time_read_int(c, 1, 3, f.yday);
+                case 'I':
+                    f.flags |= time_fields::hour12;
+                    return time_read_int(c, 1, 2, f.hour);
+                case 'H':
+                    return time_read_int(c, 1, 2, f.hour);
+                case 'M':
+                    return time_read_int(c, 1, 2, f.minute);
+                case 'S':
+                    if (!time_read_int(c, 1, 2, f.second)) {
+                        return false;
+                    }
+                    if (time_at_fraction(c)) {
+                        c.advance();
+                        return time_read_fraction(c, f.nanosecond);
+                    }
+                    return true;
+                case 'p': {
+                    static const char* const ampm[] = {"am", "pm"};
+                    if (!time_read_name(c, ampm, tmp)) {
+                        return false;
+                    }
+                    if (tmp == 1) {
+                        f.flags |= time_fields::pm;
+                    }
+                    return true;
+                }
+                case 'b':
+                case 'B':
+                case 'h':
+                    f.flags |= time_fields::month_or_day_set;
+                    if (!time_read_name(c, months, tmp)) {
+                        return false;
+                    }
+                    f.month = tmp + 1;
+                    return true;
+                case 'a':
+                case 'A':
+                    // Weekdays are checked for syntax only
+                    return time_read_name(c, weekdays, tmp);
+                case 'z':
+                    return time_read_utc_offset(c, f.utc_offset);
+                case 'T':
+                    return static_cast<bool>(
+                        time_parse_spec(c, "%H:%M:%S", 8, f));
+                case 'R':
+                    return static_cast<bool>(
+                        time_parse_spec(c, "%H:%M", 5, f));
+                case 'D':
+                    return static_cast<bool>(
+                        time_parse_spec(c, "%m/%d/%y", 8, f));
+                case 'F':
+                    return static_cast<bool>(
+                        time_parse_spec(c, "%Y-%m-%d", 8, f));
+                case 'n':
+                case 't':
+                    time_skip_space(c);
+                    return true;
+                case '%':
+                    return time_match(c, '%');
+                default:
+                    SCN_UNREACHABLE;
+            }
+        }
+
+        /**
+         * Reads a timestamp from `c`, as described by a strftime-like
+         * `spec`, that's already been validated by `time_parser::parse()`.
+         */
+        template <typename Cursor>
+        error time_parse_spec(Cursor& c,
+                              const char* spec,
+                              size_t spec_size,
+                              time_fields& f)
+        {
+            for (size_t i = 0; i < spec_size; ++i) {
+                bool ok{};
+                if (is_space(spec[i])) {
+                    time_skip_space(c);
+                    ok = true;
+                }
+                else if (spec[i] != '%') {
+                    ok = time_match(c, spec[i]);
+                }
+                else {
+                    ++i;
+                    SCN_EXPECT(i < spec_size);
+                    ok = time_parse_conversion(c, spec[i], f);
+                }
+                if (!ok) {
+                    return {error::invalid_scanned_value,
+                            "Failed to scan a time value"};
+                }
+            }
+            return {};
+        }
+
+        // Reads the optional fraction of a second, and UTC offset after
+        // "hh:mm[:ss]"
+        template <typename Cursor>
+        bool time_parse_iso_tail(Cursor& c, time_fields& f, bool seconds)
+        {
+            using char_type = typename Cursor::char_type;
+            if (seconds && time_at_fraction(c)) {
+                c.advance();
+                if (!time_read_fraction(c, f.nanosecond)) {
+                    return false;
+                }
+            }
+            char_type ch{};
+            if (!c.peek(ch)) {
+                return true;
+            }
+            if (ch == ascii_widen<char_type>('Z') ||
+                ch == ascii_widen<char_type>('z') ||
+                ((ch == ascii_widen<char_type>('+') ||
+                  ch == ascii_widen<char_type>('-')) &&
+                 c.peek_next(ch) && time_is_digit(ch))) {
+                return time_read_utc_offset(c, f.utc_offset);
+            }
+            return true;
+        }
+
+        /**
+         * Reads an ISO 8601 / RFC 3339 timestamp:
+         * "YYYY-MM-DD", optionally followed by 'T', 't' or a space,
+         * "hh:mm[:ss[.fff]]", and a UTC offset ('Z' or "+hh:mm").
+         */
+        template <typename Cursor>
+        bool time_parse_iso(Cursor& c, time_fields& f)
+        {
+            using char_type = typename Cursor::char_type;
+            if (!time_read_int(c, 4, 4, f.year) || !time_match(c, '-') ||
+                !time_read_int(c, 2, 2, f.month) || !time_match(c, '-') ||
+                !time_read_int(c, 2, 2, f.day)) {
+                return false;
+            }
+            char_type ch{};
+            if (!c.peek(ch)) {
+                return true;
+            }
+            if (ch == ascii_widen<char_type>(' ')) {
+                // A space is only a separator, if a time follows it
+                char_type next{};
+                if (!c.peek_next(next) || !time_is_digit(next)) {
+                    return true;
+                }
+            }
+            else if (ch != ascii_widen<char_type>('T') &&
+                     ch != ascii_widen<char_type>('t')) {
+                return true;
+            }
+            c.advance();
+            if (!time_read_int(c, 2, 2, f.hour) || !time_match(c, ':') ||
+                !time_read_int(c, 2, 2, f.minute)) {
+                return false;
+            }
+            const bool seconds =
+                c.peek(ch) && ch == ascii_widen<char_type>(':');
+            if (seconds &&
+                (!time_match(c, ':') || !time_read_int(c, 2, 2, f.second))) {
+                return false;
+            }
+            return time_parse_iso_tail(c, f, seconds);
+        }
+
+        /**
+         * Checks that the 8 characters in `w` match a pattern of digits and
+         * separators, and combines every pair of adjacent digits: byte `i`
+         * of the result is `10 * digit[i] + digit[i + 1]`.
+         *
+         * \param sep_mask `0xff` for a separator byte, `0` for a digit
+         * \param seps The separators, `0` for a digit
+         */
+        inline bool time_swar_pairs(std::uint64_t w,
+                                    std::uint64_t sep_mask,
+                                    std::uint64_t seps,
+                                    std::uint64_t& pairs) noexcept
+        {
+            const auto digit_mask = ~sep_mask & (swar_ones * 0xf0u);
+            // Digits are 0x30..0x39:
+            // high nibble 3, and adding 6 doesn't carry out of it
+            const auto digits = swar_ones * 0x30u & digit_mask;
+            if ((w & (digit_mask | sep_mask)) != (seps | digits) ||
+                ((w + (swar_ones * 0x06u & ~sep_mask)) & digit_mask) !=
+                    digits) {
+                return false;
+            }
+            const auto v = w & (swar_ones * 0x0fu);
+            pairs = v * 10u + (v >> 8u);
+            return true;
+        }
+
+        /**
+         * Reads "YYYY-MM-DDThh:mm:ss" from `p`, which must contain at least
+         * 19 characters. The digits are in fixed positions, so they're
+         * validated and converted 8 at a time.
+         */
+        inline bool time_parse_iso_head(const char* p,
+                                        time_fields& f) noexcept
+        {
+            if (!time_is_digit(p[8]) || !time_is_digit(p[9]) ||
+                (p[10] != 'T' && p[10] != 't' && p[10] != ' ')) {
+                return false;
+            }
+            // "YYYY-MM-"
+            std::uint64_t date{};
+            if (!time_swar_pairs(swar_load(p), 0xff0000ff00000000ull,
+                                 0x2d00002d00000000ull, date)) {
+                return false;
+            }
+            // "hh:mm:ss"
+            std::uint64_t time{};
+            if (!time_swar_pairs(swar_load(p + 11),
+                                 0x0000ff0000ff0000ull, 0x00003a00003a0000ull,
+                                 time)) {
+                return false;
+            }
+            const auto byte = [](std::uint64_t w, unsigned i) {
+                return static_cast<int>((w >> (8u * i)) & 0xffu);
+            };
+            f.year = byte(date, 0) * 100 + byte(date, 2);
+            f.month = byte(date, 5);
+            f.day = (p[8] - '0') * 10 + (p[9] - '0');
+            f.hour = byte(time, 0);
+            f.minute = byte(time, 3);
+            f.second = byte(time, 6);
+            return true;
+        }
+
+        template <typename Cursor>
+        bool time_parse_iso_fast(Cursor& c, time_fields& f)
+        {
+            return time_parse_iso(c, f);
+        }
+        inline bool time_parse_iso_fast(time_span_cursor<char>& c,
+                                        time_fields& f)
+        {
+            if (c.size() >= 19 && time_parse_iso_head(c.data(), f)) {
+                c.advance(19);
+                return time_parse_iso_tail(c, f, true);
+            }
+            return time_parse_iso(c, f);
+        }
+
+        /**
+         * Parses a strftime-like format string for a time value, and reads
+         * time values from a range into `time_fields`.
+         *
+         * Supported conversion specifiers:
+         *  - `%Y`, `%y`: year, with up to 4 and 2 digits. Two-digit years
+         *    are in 1969-2068
+         *  - `%m`, `%d`, `%e`, `%j`: month, day of month, and day of year
+         *  - `%b`, `%h`, `%B`: English month name, full or abbreviated
+         *  - `%a`, `%A`: English weekday name, ignored
+         *  - `%H`, `%I`, `%p`: hours on a 24-hour or 12-hour clock, and AM/PM
+         *  - `%M`, `%S`: minutes and seconds. Seconds can have a fractional
+         *    part, separated with <tt>'.'</tt> or <tt>','</tt>
+         *  - `%z`: UTC offset, as `Z`, `+hh`, `+hhmm` or `+hh:mm`
+         *  - `%F`, `%T`, `%D`, `%R`: `%Y-%m-%d`, `%H:%M:%S`, `%m/%d/%y`, and
+         *    `%H:%M`
+         *  - `%n`, `%t`, and whitespace: any amount of whitespace
+         *  - `%%`: a literal <tt>'%'</tt>
+         *
+         * Without a format string, an ISO 8601 / RFC 3339 timestamp is read.
+         * Names and digits are read without a locale, and no memory is
+         * allocated.
+         */
+        struct time_parser : parser_base {
+            template <typename ParseCtx>
+            error parse(ParseCtx& pctx)
+            {
+                pctx.arg_begin();
+                if (SCN_UNLIKELY(!pctx)) {
+                    return {error::invalid_format_string,
+                            "Unexpected format string end"};
+                }
+                spec_size = 0;
+                bool conversion = false;
+                while (!pctx.check_arg_end()) {
+                    const auto ch = pctx.next_char();
+                    if (static_cast<char32_t>(ch) >= 0x80 ||
+                        spec_size == sizeof(spec)) {
+                        return {error::invalid_format_string,
+                                "Invalid time format string"};
+                    }
+                    const auto c = static_cast<char>(ch);
+                    if (conversion &&
+                        std::strchr("YymdejbBhaAHIpMSzFTDRnt%", c) ==
+                            nullptr) {
+                        return {error::invalid_format_string,
+                                "Invalid conversion specifier in time "
+                                "format string"};
+                    }
+                    conversion = !conversion && c == '%';
+                    spec[spec_size++] = c;
+
+                    pctx.advance_char();
+                    if (SCN_UNLIKELY(!pctx)) {
+                        return {error::invalid_format_string,
+                                "Unexpected format string end"};
+                    }
+                }
+                if (conversion) {
+                    return {error::invalid_format_string,
+                            "Invalid time format string"};
+                }
+                pctx.arg_end();
+                return {};
+            }
+
+            /**
+             * Reads a time value from `ctx` into `f`, and validates it.
+             */
+            template <typename Context>
+            error scan_fields(time_fields& f, Context& ctx)
+            {
+                return _scan_fields(
+                    f, ctx,
+                    std::integral_constant<
+                        bool, Context::range_type::is_contiguous>{});
+            }
+
+            char spec[32] = {0};
+            size_t spec_size{0};
+
+        private:
+            template <typename Cursor>
+            error _scan_fields(time_fields& f, Cursor& c)
+            {
+                error e{};
+                if (spec_size == 0) {
+                    if (!time_parse_iso_fast(c, f)) {
+                        e = {error::invalid_scanned_value,
+                             "Failed to scan a time value"};
+                    }
+                }
+                else {
+                    e = time_parse_spec(c, spec, spec_size, f);
+                }
+                if (!e) {
+                    auto se = c.source_error();
+                    if (!se) {
+                        return se;
+                    }
+                    if (c.consumed() == 0) {
+                        typename Cursor::char_type ch{};
+                        if (!c.peek(ch)) {
+                            return {error::end_of_range, "EOF"};
+                        }
+                    }
+                    return e;
+                }
+                return finish_time_fields(f);
+            }
+
+            template <typename Context>
+            error _scan_fields(time_fields& f, Context& ctx, std::true_type)
+            {
+                using char_type = typename Context::char_type;
+                auto& r = ctx.range();
+                auto c = time_span_cursor<char_type>{
+                    r.data(), r.data() + r.size()};
+                auto e = _scan_fields(f, c);
+                r.advance(c.consumed());
+                return e;
+            }
+            template <typename Context>
+            error _scan_fields(time_fields& f, Context& ctx, std::false_type)
+            {
+                auto c = time_range_cursor<typename Context::range_type>{
+                    ctx.range()};
+                return _scan_fields(f, c);
+            }
+        };
+
+        // Unit suffix of a duration, like in "10ms", if there is one
+        template <typename Period>
+        struct duration_suffix {
+            static constexpr const char* value()
+            {
+                return nullptr;
+            }
+        };
+#define SCN_DURATION_SUFFIX(P, S)              \
+    template <>                                \
+    struct duration_suffix<P> {                \
+        static constexpr const char* value()   \
+        {                                      \
+            return S;                          \
+        }                                      \
+    };
+        SCN_DURATION_SUFFIX(std::nano, "ns")
+        SCN_DURATION_SUFFIX(std::micro, "us")
+        SCN_DURATION_SUFFIX(std::milli, "ms")
+        SCN_DURATION_SUFFIX(std::ratio<1>, "s")
+        SCN_DURATION_SUFFIX(std::ratio<60>, "min")
+        SCN_DURATION_SUFFIX(std::ratio<3600>, "h")
+        SCN_DURATION_SUFFIX(std::ratio<86400>, "d")
+#undef SCN_DURATION_SUFFIX
+    }  // namespace detail
+
+    /**
+     * Scans a `std::tm`.
+     * See `detail::time_parser` for the supported format strings.
+     *
+     * Fields not given in the format string are taken from
+     * 1970-01-01 00:00:00.
+     * `tm_wday` and `tm_yday` are calculated from the date, and `tm_isdst`
+     * is set to `0`.
+     * A UTC offset (`%z`) is read, but not applied.
+     */
+    template <>
+    struct scanner<std::tm> : detail::time_parser {
+        template <typename Context>
+        error scan(std::tm& val, Context& ctx)
+        {
+            detail::time_fields f{};
+            auto e = scan_fields(f, ctx);
+            if (!e) {
+                return e;
+            }
+            const auto days = detail::days_from_civil(f.year, f.month, f.day);
+            val = std::tm{};
+            val.tm_year = f.year - 1900;
+            val.tm_mon = f.month - 1;
+            val.tm_mday = f.day;
+            val.tm_hour = f.hour;
+            val.tm_min = f.minute;
+            val.tm_sec = f.second;
+            val.tm_yday = static_cast<int>(
+                days - detail::days_from_civil(f.year, 1, 1));
+            // 1970-01-01 was a Thursday
+            val.tm_wday = static_cast<int>(((days % 7) + 11) % 7);
+            val.tm_isdst = 0;
+            return {};
+        }
+    };
+
+    /**
+     * Scans a `std::chrono::time_point` of `std::chrono::system_clock`
+     * (`std::chrono::sys_time` in C++20), as a UTC time.
+     * See `detail::time_parser` for the supported format strings.
+     *
+     * Fields not given in the format string are taken from
+     * 1970-01-01 00:00:00. A UTC offset (`%z`) is subtracted from the time
+     * read.
+     */
+    template <typename Duration>
+    struct scanner<
+        std::chrono::time_point<std::chrono::system_clock, Duration>>
+        : detail::time_parser {
+        template <typename Context>
+        error scan(
+            std::chrono::time_point<std::chrono::system_clock, Duration>& val,
+            Context& ctx)
+        {
+            detail::time_fields f{};
+            auto e = scan_fields(f, ctx);
+            if (!e) {
+                return e;
+            }
+            const auto secs =
+                detail::days_from_civil(f.year, f.month, f.day) * 86400 +
+                f.hour * 3600 + f.minute * 60 + f.second - f.utc_offset;
+            val = std::chrono::time_point<std::chrono::system_clock, Duration>{
+                std::chrono::duration_cast<Duration>(
+                    std::chrono::seconds{secs}) +
+                std::chrono::duration_cast<Duration>(
+                    std::chrono::nanoseconds{f.nanosecond})};
+            return {};
+        }
+    };
+
+    /**
+     * Scans a `std::chrono::duration`.
+     *
+     * Without a format string, reads a count of `Rep`, optionally followed
+     * by the unit suffix of `Period`, e.g. `"10ms"` for
+     * `std::chrono::milliseconds`.
+     * The suffixes are `ns`, `us`, `ms`, `s`, `min`, `h`, and `d`.
+     *
+     * With a format string, reads hours, minutes, seconds and fractions of
+     * a second, e.g. with `"{:%T}"`, like a time of day: see
+     * `detail::time_parser`.
+     */
+    template <typename Rep, typename Period>
+    struct scanner<std::chrono::duration<Rep, Period>> : detail::time_parser {
+        template <typename Context>
+        error scan(std::chrono::duration<Rep, Period>& val, Context& ctx)
+        {
+            if (spec_size == 0) {
+                return _scan_count(val, ctx);
+            }
+            detail::time_fields f{};
+            auto e = scan_fields(f, ctx);
+            if (!e) {
+                return e;
+            }
+            val = std::chrono::duration_cast<
+                      std::chrono::duration<Rep, Period>>(std::chrono::seconds{
+                      f.hour * 3600 + f.minute * 60 + f.second}) +
+                  std::chrono::duration_cast<
+                      std::chrono::duration<Rep, Period>>(
+                      std::chrono::nanoseconds{f.nanosecond});
+            return {};
+        }
+
+    private:
+        template <typename Context>
+        error _scan_count(std::chrono::duration<Rep, Period>& val,
+                          Context& ctx)
+        {
+            using char_type = typename Context::char_type;
+
+            Rep count{};
+            auto pctx = make_parse_context(1, ctx.locale());
+            auto e = basic_visitor<Context, decltype(pctx)>(ctx, pctx)(count);
+            if (!e) {
+                return e;
+            }
+
+            auto c = detail::time_range_cursor<typename Context::range_type>{
+                ctx.range()};
+            char buf[4] = {0};
+            size_t len = 0;
+            char_type ch{};
+            while (len < sizeof(buf) && c.peek(ch) &&
+                   ((ch >= detail::ascii_widen<char_type>('a') &&
+                     ch <= detail::ascii_widen<char_type>('z')))) {
+                buf[len++] = static_cast<char>(ch);
+                c.advance();
+            }
+            if (len != 0) {
+                const auto suffix = detail::duration_suffix<Period>::value();
+                if (!suffix || std::strlen(suffix) != len ||
+                    std::memcmp(buf, suffix, len) != 0) {
+                    return {error::invalid_scanned_value,
+                            "Invalid unit suffix for a duration"};
+                }
+            }
+            val = std::chrono::duration<Rep, Period>{count};
+            return {};
+        }
+    };
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#endif  // SCN_READER_CHRONO_H
@@ -23,6 +23,7 @@
 #include "../detail/range.h"
 #include "../unicode/unicode.h"
 #include "../util/algorithm.h"
+#include "../util/memory_resource.h"
 
 namespace scn {
     SCN_BEGIN_NAMESPACE
@@ -114,6 +115,8 @@ namespace scn {
     error putback_n(WrappedRange& r, ranges::range_difference_t<WrappedRange> n)
     {
         SCN_EXPECT(n <= ranges::distance(r.begin_underlying(), r.begin()));
+        SCN_STATS_ADD(putbacks, 1);
+        SCN_STATS_ADD(putback_chars, n);
         r.advance(-n);
         return {};
     }
@@ -122,6 +125,8 @@ namespace scn {
         typename std::enable_if<!WrappedRange::is_contiguous>::type* = nullptr>
     error putback_n(WrappedRange& r, ranges::range_difference_t<WrappedRange> n)
     {
+        SCN_STATS_ADD(putbacks, 1);
+        SCN_STATS_ADD(putback_chars, n);
         for (ranges::range_difference_t<WrappedRange> i = 0; i < n; ++i) {
             r.advance(-1);
             if (r.begin() == r.end()) {
@@ -319,6 +324,115 @@ namespace scn {
         SCN_GCC_POP
     }
 
+    // read_code_points
+
+    namespace detail {
+        template <typename WrappedRange>
+        expected<span<code_point>> read_code_points_single(
+            WrappedRange& r,
+            span<code_point> out,
+            code_point* it)
+        {
+            unsigned char buf[4] = {0};
+            for (; it != out.end(); ++it) {
+                auto ret = read_code_point(r, make_span(buf, 4));
+                if (!ret) {
+                    if (it != out.begin()) {
+                        break;
+                    }
+                    return ret.error();
+                }
+                *it = ret.value().cp;
+            }
+            return make_span(out.begin(), it);
+        }
+
+        template <typename WrappedRange>
+        expected<span<code_point>> read_code_points_impl(
+            WrappedRange& r,
+            span<code_point> out,
+            std::true_type)
+        {
+            using char_type = typename WrappedRange::char_type;
+            using tag = std::integral_constant<size_t, sizeof(char_type)>;
+
+            auto it = out.begin();
+            while (it != out.end() && r.begin() != r.end()) {
+                auto buf = r.get_buffer_and_advance(
+                    static_cast<size_t>(out.end() - it));
+                auto buf_it = buf.begin();
+                auto e = decode_code_points(buf_it, buf.end(), it, out.end(),
+                                            tag{});
+                if (buf_it != buf.end()) {
+                    auto pb = putback_n(r, buf.end() - buf_it);
+                    if (!pb) {
+                        return pb;
+                    }
+                }
+                if (!e) {
+                    if (it != out.begin()) {
+                        break;
+                    }
+                    return e;
+                }
+                if (buf_it == buf.begin()) {
+                    // No buffer available, or a code point straddling
+                    // the end of it: fall back to reading code units
+                    auto ret = read_code_points_single(
+                        r, make_span(out.begin(), it + 1), it);
+                    if (!ret) {
+                        if (it != out.begin()) {
+                            break;
+                        }
+                        return ret.error();
+                    }
+                    ++it;
+                }
+            }
+            if (it == out.begin() && r.begin() == r.end()) {
+                return error(error::end_of_range, "EOF");
+            }
+            return make_span(out.begin(), it);
+        }
+
+        template <typename WrappedRange>
+        expected<span<code_point>> read_code_points_impl(
+            WrappedRange& r,
+            span<code_point> out,
+            std::false_type)
+        {
+            return read_code_points_single(r, out, out.begin());
+        }
+    }  // namespace detail
+
+    /**
+     * Reads Unicode code points from `r` into `out`, until either `out` is
+     * full, or the range is exhausted.
+     *
+     * If `r` provides buffer access, whole buffers are decoded in bulk with
+     * `decode_code_points()`. Otherwise, equivalent to repeatedly calling
+     * `read_code_point()`.
+     *
+     * Advances the range past the read code points. If an error occurs after
+     * some code points have already been read, the range is left at the
+     * offending code point, and the code points read so far are returned: the
+     * error will be reported by the next call.
+     *
+     * \return The part of `out` that was written into.
+     * If `r.begin() == r.end()`, returns EOF.
+     * If the first code point was not encoded correctly, returns
+     * `error::invalid_encoding`.
+     */
+    template <typename WrappedRange>
+    expected<span<code_point>> read_code_points(WrappedRange& r,
+                                                span<code_point> out)
+    {
+        return detail::read_code_points_impl(
+            r, out,
+            std::integral_constant<bool,
+                                   WrappedRange::provides_buffer_access>{});
+    }
+
     // read_zero_copy
 
     /// @{
@@ -625,6 +739,83 @@ namespace scn {
     // read_until_space
 
     namespace detail {
+        template <typename CharT>
+        struct ignore_iterator {
+            using value_type = CharT;
+            using pointer = value_type*;
+            using reference = value_type&;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::output_iterator_tag;
+
+            constexpr ignore_iterator() = default;
+
+            SCN_CONSTEXPR14 ignore_iterator& operator=(CharT) noexcept
+            {
+                return *this;
+            }
+            constexpr const ignore_iterator& operator=(CharT) const noexcept
+            {
+                return *this;
+            }
+
+            SCN_CONSTEXPR14 ignore_iterator& operator*() noexcept
+            {
+                return *this;
+            }
+            constexpr const ignore_iterator& operator*() const noexcept
+            {
+                return *this;
+            }
+
+            SCN_CONSTEXPR14 ignore_iterator& operator++() noexcept
+            {
+                return *this;
+            }
+            constexpr const ignore_iterator& operator++() const noexcept
+            {
+                return *this;
+            }
+        };
+
+        template <typename CharT>
+        struct ignore_iterator_n {
+            using value_type = CharT;
+            using pointer = value_type*;
+            using reference = value_type&;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::output_iterator_tag;
+
+            ignore_iterator_n() = default;
+            ignore_iterator_n(difference_type n) : i(n) {}
+
+            constexpr const ignore_iterator_n& operator=(CharT) const noexcept
+            {
+                return *this;
+            }
+
+            constexpr const ignore_iterator_n& operator*() const noexcept
+            {
+                return *this;
+            }
+
+            SCN_CONSTEXPR14 ignore_iterator_n& operator++() noexcept
+            {
+                ++i;
+                return *this;
+            }
+
+            constexpr bool operator==(const ignore_iterator_n& o) const noexcept
+            {
+                return i == o.i;
+            }
+            constexpr bool operator!=(const ignore_iterator_n& o) const noexcept
+            {
+                return !(*this == o);
+            }
+
+            difference_type i{0};
+        };
+
         template <typename WrappedRange,
                   typename Predicate,
                   typename OutputIt,
@@ -647,6 +838,7 @@ namespace scn {
                             if (keep_final) {
                                 *out = *it;
                                 ++out;
+                                ++it;
                             }
                             auto e =
                                 putback_n(r, ranges::distance(it, s.end()));
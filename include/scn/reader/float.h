@@ -24,6 +24,52 @@
 namespace scn {
     SCN_BEGIN_NAMESPACE
     namespace detail {
+        /**
+         * Predicate for reading a floating-point value: stops on whitespace,
+         * like `is_space_predicate`, but also on ASCII characters that can't
+         * be a part of a floating-point number.
+         *
+         * This way, a value directly followed by a separator (like in
+         * `"1.5,2.5"`) doesn't take the whole rest of the source with it.
+         */
+        template <typename CharT>
+        struct float_token_predicate {
+            bool operator()(span<const CharT> ch)
+            {
+                if (is_space(ch)) {
+                    return true;
+                }
+                const auto c = ch[0];
+                if (c == decimal_point || c == thousands_separator) {
+                    return false;
+                }
+                if (static_cast<unsigned long>(c) > 0x7f) {
+                    return false;
+                }
+                return !((c >= ascii_widen<CharT>('0') &&
+                          c <= ascii_widen<CharT>('9')) ||
+                         (c >= ascii_widen<CharT>('a') &&
+                          c <= ascii_widen<CharT>('z')) ||
+                         (c >= ascii_widen<CharT>('A') &&
+                          c <= ascii_widen<CharT>('Z')) ||
+                         c == ascii_widen<CharT>('.') ||
+                         c == ascii_widen<CharT>('+') ||
+                         c == ascii_widen<CharT>('-') ||
+                         c == ascii_widen<CharT>('(') ||
+                         c == ascii_widen<CharT>(')') ||
+                         c == ascii_widen<CharT>('_'));
+            }
+
+            constexpr bool is_multibyte() const
+            {
+                return is_space.is_multibyte();
+            }
+
+            is_space_predicate<CharT> is_space;
+            CharT decimal_point;
+            CharT thousands_separator;
+        };
+
         template <typename T>
         struct float_scanner_access;
 
@@ -128,6 +174,18 @@ namespace scn {
             {
                 using char_type = typename Context::char_type;
 
+                if (ctx.trusted() && common_options == 0 &&
+                    format_options ==
+                        (allow_hex | allow_scientific | allow_fixed)) {
+                    error e{};
+                    if (_scan_unchecked(
+                            val, ctx, e,
+                            std::integral_constant<
+                                bool, Context::range_type::is_contiguous>{})) {
+                        return e;
+                    }
+                }
+
                 auto do_parse_float = [&](span<const char_type> s) -> error {
                     SCN_EXPECT(!s.empty());
                     T tmp = 0;
@@ -144,7 +202,8 @@ namespace scn {
 #if SCN_DISABLE_LOCALE
                     ret =
                         _read_float(tmp, s.subspan(sign_offset),
-                                    ctx.locale().get_static().decimal_point());
+                                    ctx.locale().get_static().decimal_point(),
+                                    ctx.resource());
 #else
                     if (SCN_UNLIKELY((format_options & localized_digits) != 0 ||
                                      ((common_options & localized) != 0 &&
@@ -165,7 +224,8 @@ namespace scn {
                             tmp, s.subspan(sign_offset),
                             ctx.locale()
                                 .get((common_options & localized) != 0)
-                                .decimal_point());
+                                .decimal_point(),
+                            ctx.resource());
                     }
                     if (has_negative_sign) {
                         SCN_EXPECT(std::isnan(tmp) ||
@@ -193,6 +253,78 @@ namespace scn {
                     ctx.locale(), (common_options & localized) != 0,
                     field_width);
 
+                if ((format_options & localized_digits) == 0) {
+#if SCN_DISABLE_LOCALE
+                    const auto loc = ctx.locale().get_static();
+#else
+                    const auto& loc =
+                        ctx.locale().get((common_options & localized) != 0);
+#endif
+                    return _scan_token(
+                        ctx,
+                        float_token_predicate<char_type>{
+                            is_space_pred, loc.decimal_point(),
+                            (format_options & allow_thsep) != 0
+                                ? loc.thousands_separator()
+                                : loc.decimal_point()},
+                        do_parse_float);
+                }
+                return _scan_token(ctx, is_space_pred, do_parse_float);
+            }
+
+            enum format_options_type {
+                allow_hex = 1,
+                allow_scientific = 2,
+                allow_fixed = 4,
+                localized_digits = 8,
+                allow_thsep = 16
+            };
+            uint8_t format_options{allow_hex | allow_scientific | allow_fixed};
+
+        private:
+            // Trusted source: parse directly from the range, without first
+            // reading the value into a null-terminated buffer.
+            // Returns `false` if the regular path should be taken instead.
+            template <typename Context>
+            bool _scan_unchecked(T& val,
+                                 Context& ctx,
+                                 error& e,
+                                 std::true_type)
+            {
+                using char_type = typename Context::char_type;
+
+                auto& r = ctx.range();
+                if (r.begin() == r.end()) {
+                    e = {error::end_of_range, "EOF"};
+                    return true;
+                }
+                size_t chars{};
+                SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
+                auto ret = _read_float_unchecked(
+                    span<const char_type>{r.data(),
+                                          static_cast<size_t>(r.size())},
+                    chars);
+                SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
+                if (!ret) {
+                    return false;
+                }
+                r.advance(static_cast<std::ptrdiff_t>(chars));
+                val = ret.value();
+                return true;
+            }
+            template <typename Context>
+            bool _scan_unchecked(T&, Context&, error&, std::false_type)
+            {
+                return false;
+            }
+
+            template <typename Context, typename Predicate, typename Parse>
+            static error _scan_token(Context& ctx,
+                                     Predicate is_space_pred,
+                                     Parse& do_parse_float)
+            {
+                using char_type = typename Context::char_type;
+
                 if (Context::range_type::is_contiguous) {
                     auto s = read_until_space_zero_copy(ctx.range(),
                                                         is_space_pred, false);
@@ -213,23 +345,15 @@ namespace scn {
                 return do_parse_float(make_span(buf));
             }
 
-            enum format_options_type {
-                allow_hex = 1,
-                allow_scientific = 2,
-                allow_fixed = 4,
-                localized_digits = 8,
-                allow_thsep = 16
-            };
-            uint8_t format_options{allow_hex | allow_scientific | allow_fixed};
-
-        private:
             template <typename CharT>
             expected<std::ptrdiff_t> _read_float(T& val,
                                                  span<const CharT> s,
-                                                 CharT locale_decimal_point)
+                                                 CharT locale_decimal_point,
+                                                 memory_resource* resource)
             {
                 size_t chars{};
-                std::basic_string<CharT> str(s.data(), s.size());
+                resource_string<CharT> str(
+                    s.data(), s.size(), polymorphic_allocator<CharT>{resource});
                 SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
                 auto ret =
                     _read_float_impl(str.data(), chars, locale_decimal_point);
@@ -245,6 +369,15 @@ namespace scn {
             expected<T> _read_float_impl(const CharT* str,
                                          size_t& chars,
                                          CharT locale_decimal_point);
+
+            // Parses a float from the beginning of `s`, which doesn't need
+            // to be null-terminated, with the default format options.
+            // Fails, if the value needs one of the fallbacks of
+            // `_read_float_impl()`, or if there's no fast path for
+            // `CharT` and `T`.
+            template <typename CharT>
+            expected<T> _read_float_unchecked(span<const CharT> s,
+                                              size_t& chars);
         };
 
         // instantiate
@@ -256,6 +389,7 @@ namespace scn {
         struct float_scanner_access : public float_scanner<T> {
             using float_scanner<T>::_read_float;
             using float_scanner<T>::_read_float_impl;
+            using float_scanner<T>::_read_float_unchecked;
         };
     }  // namespace detail
     SCN_END_NAMESPACE
@@ -25,6 +25,53 @@ namespace scn {
     SCN_BEGIN_NAMESPACE
 
     namespace detail {
+        /**
+         * Parses a base-10 integer from the beginning of `s`, without
+         * checking for overflow.
+         *
+         * \return The number of code units consumed, or `0` if `s` doesn't
+         * begin with a number
+         */
+        template <typename T, typename CharT>
+        std::ptrdiff_t parse_int_unchecked(span<const CharT> s, T& val)
+        {
+            using utype = typename std::make_unsigned<T>::type;
+
+            auto it = s.begin();
+            bool minus_sign = false;
+            if (it != s.end()) {
+                if (*it == ascii_widen<CharT>('-')) {
+                    if (std::is_unsigned<T>::value) {
+                        return 0;
+                    }
+                    minus_sign = true;
+                    ++it;
+                }
+                else if (*it == ascii_widen<CharT>('+')) {
+                    ++it;
+                }
+            }
+
+            const auto digits_begin = it;
+            utype tmp = 0;
+            for (; it != s.end(); ++it) {
+                if (*it < ascii_widen<CharT>('0') ||
+                    *it > ascii_widen<CharT>('9')) {
+                    break;
+                }
+                const auto digit =
+                    static_cast<utype>(*it - ascii_widen<CharT>('0'));
+                tmp = static_cast<utype>(tmp * 10u + digit);
+            }
+            if (it == digits_begin) {
+                return 0;
+            }
+
+            val = minus_sign ? static_cast<T>(static_cast<utype>(0u - tmp))
+                             : static_cast<T>(tmp);
+            return ranges::distance(s.begin(), it);
+        }
+
         template <typename T>
         struct integer_scanner : common_parser {
             static_assert(std::is_integral<T>::value,
@@ -328,7 +375,21 @@ namespace scn {
                 }
                 SCN_MSVC_POP
 
-                std::basic_string<char_type> buf{};
+                // base == 0 is base detection ({:i}), and a prefix can
+                // change the value: only plain base 10 takes the fast path
+                if (ctx.trusted() && base == 10 &&
+                    format_options == 0 && field_width == 0) {
+                    error e{};
+                    if (_scan_unchecked(
+                            val, ctx, e,
+                            std::integral_constant<
+                                bool, Context::range_type::is_contiguous>{})) {
+                        return e;
+                    }
+                }
+
+                resource_string<char_type> buf{
+                    polymorphic_allocator<char_type>{ctx.resource()}};
                 span<const char_type> bufspan{};
                 auto e = _read_source(
                     ctx, buf, bufspan,
@@ -373,6 +434,55 @@ namespace scn {
             }
 
         private:
+            // Trusted source: parse base 10 directly from the range, without
+            // overflow checks.
+            // Returns `false` if the regular path should be taken instead.
+            template <typename Context>
+            bool _scan_unchecked(T& val,
+                                 Context& ctx,
+                                 error& e,
+                                 std::true_type)
+            {
+                using char_type = typename Context::char_type;
+
+                auto& r = ctx.range();
+                if (r.begin() == r.end()) {
+                    e = {error::end_of_range, "EOF"};
+                    return true;
+                }
+                const auto s = span<const char_type>{
+                    r.data(), static_cast<size_t>(r.size())};
+
+                T tmp{};
+                const auto n = parse_int_unchecked(s, tmp);
+#if SCN_HAS_RELAXED_CONSTEXPR && !defined(NDEBUG)
+                // Only when SCN_ENSURE checks something
+                {
+                    integer_scanner checker{};
+                    checker.base = base;
+                    T checked{};
+                    SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
+                    auto ret = checker._parse_int(checked, s);
+                    SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
+                    SCN_ENSURE((n == 0 && !ret) ||
+                               (ret && ret.value() == n && checked == tmp));
+                }
+#endif
+                if (n == 0) {
+                    e = {error::invalid_scanned_value,
+                         "Expected an integer"};
+                    return true;
+                }
+                r.advance(n);
+                val = tmp;
+                return true;
+            }
+            template <typename Context>
+            bool _scan_unchecked(T&, Context&, error&, std::false_type)
+            {
+                return false;
+            }
+
             template <typename Context, typename Buf, typename CharT>
             error _read_source(Context& ctx,
                                Buf& buf,
@@ -402,7 +512,7 @@ namespace scn {
                     return {};
                 }
 
-                Buf tmp;
+                Buf tmp{buf.get_allocator()};
                 auto e = do_read(tmp);
                 if (!e) {
                     return e;
@@ -0,0 +1,470 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_READER_NETWORK_H
+#define SCN_READER_NETWORK_H
+
+#include "../detail/visitor.h"
+#include "../util/swar.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    /// An IPv4 address, like `"192.0.2.1"`, in network byte order
+    struct ipv4_address {
+        std::array<unsigned char, 4> bytes{};
+    };
+    /// An IPv6 address, like `"2001:db8::1"`, in network byte order
+    struct ipv6_address {
+        std::array<unsigned char, 16> bytes{};
+    };
+    /// A UUID, like `"123e4567-e89b-12d3-a456-426614174000"`
+    struct uuid {
+        std::array<unsigned char, 16> bytes{};
+    };
+    /// A MAC address, like `"00:1a:2b:3c:4d:5e"` or `"00-1A-2B-3C-4D-5E"`
+    struct mac_address {
+        std::array<unsigned char, 6> bytes{};
+    };
+
+    namespace detail {
+        // -1, if `ch` is not a hex digit
+        template <typename CharT>
+        SCN_CONSTEXPR14 int hex_digit_value(CharT ch) noexcept
+        {
+            const auto c = static_cast<char32_t>(ch);
+            if (c >= U'0' && c <= U'9') {
+                return static_cast<int>(c - U'0');
+            }
+            if ((c | 0x20u) >= U'a' && (c | 0x20u) <= U'f') {
+                return static_cast<int>((c | 0x20u) - U'a') + 10;
+            }
+            return -1;
+        }
+
+        /**
+         * Checks that the 8 characters in `w` match a pattern of hex digits
+         * and separators, and combines every pair of adjacent digits: byte
+         * `i` of the result is `16 * digit[i] + digit[i + 1]`.
+         *
+         * \param sep_mask `0xff` for a separator byte, `0` for a digit
+         * \param seps The separators, `0` for a digit
+         */
+        inline bool address_swar_hex_pairs(std::uint64_t w,
+                                           std::uint64_t sep_mask,
+                                           std::uint64_t seps,
+                                           std::uint64_t& pairs) noexcept
+        {
+            const auto digit_high = swar_high & ~sep_mask;
+            if ((w & sep_mask) != seps || (w & digit_high) != 0) {
+                return false;
+            }
+            const auto digit = swar_between(w, '0', '9');
+            const auto alpha = swar_between(w | (swar_ones * 0x20u), 'a', 'f');
+            if (((digit | alpha) & digit_high) != digit_high) {
+                return false;
+            }
+            const auto v = (w & (swar_ones * 0x0fu)) + (alpha >> 7u) * 9u;
+            pairs = (v << 4u) | (v >> 8u);
+            return true;
+        }
+
+        inline unsigned char address_swar_byte(std::uint64_t w,
+                                               unsigned i) noexcept
+        {
+            return static_cast<unsigned char>(w >> (8u * i));
+        }
+
+        // Reads a decimal octet without leading zeroes
+        template <typename CharT>
+        bool parse_ipv4_octet(const CharT*& it,
+                              const CharT* end,
+                              unsigned char& out)
+        {
+            int val = 0;
+            int n = 0;
+            for (; it != end && n < 4; ++it, ++n) {
+                const auto d = static_cast<int>(*it) - '0';
+                if (d < 0 || d > 9) {
+                    break;
+                }
+                val = val * 10 + d;
+            }
+            if (n == 0 || n == 4 || val > 255 ||
+                (n > 1 && *(it - n) == ascii_widen<CharT>('0'))) {
+                return false;
+            }
+            out = static_cast<unsigned char>(val);
+            return true;
+        }
+
+        template <typename CharT>
+        bool parse_ipv4_bytes(const CharT*& it,
+                              const CharT* end,
+                              unsigned char* out)
+        {
+            for (int i = 0; i < 4; ++i) {
+                if (i != 0) {
+                    if (it == end || *it != ascii_widen<CharT>('.')) {
+                        return false;
+                    }
+                    ++it;
+                }
+                if (!parse_ipv4_octet(it, end, out[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template <typename CharT>
+        expected<std::ptrdiff_t> parse_address(span<const CharT> s,
+                                               ipv4_address& val)
+        {
+            auto it = s.data();
+            if (!parse_ipv4_bytes(it, s.data() + s.size(),
+                                  val.bytes.data())) {
+                return error(error::invalid_scanned_value,
+                             "Invalid IPv4 address");
+            }
+            return {it - s.data()};
+        }
+
+        /**
+         * Reads an IPv6 address, as described in RFC 4291 section 2.2:
+         * up to eight groups of hex digits, where consecutive zero groups can
+         * be compressed into "::", and the last two groups can be written as
+         * an IPv4 address.
+         */
+        template <typename CharT>
+        expected<std::ptrdiff_t> parse_address(span<const CharT> s,
+                                               ipv6_address& val)
+        {
+            const auto colon = ascii_widen<CharT>(':');
+            const auto invalid = error(error::invalid_scanned_value,
+                                       "Invalid IPv6 address");
+            const CharT* it = s.data();
+            const CharT* const end = s.data() + s.size();
+
+            unsigned char bytes[16] = {0};
+            int n = 0;     // bytes written
+            int gap = -1;  // position of "::"
+            if (end - it >= 2 && it[0] == colon && it[1] == colon) {
+                gap = 0;
+                it += 2;
+            }
+            while (n < 16) {
+                const CharT* group_begin = it;
+                unsigned group = 0;
+                int digits = 0;
+                for (int d; it != end && (d = hex_digit_value(*it)) >= 0;
+                     ++it, ++digits) {
+                    group = (group << 4u) | static_cast<unsigned>(d);
+                }
+                if (digits == 0) {
+                    if (gap == n) {
+                        // "::" at the end
+                        break;
+                    }
+                    return invalid;
+                }
+                if (it != end && *it == ascii_widen<CharT>('.') && n <= 12) {
+                    // embedded IPv4 address
+                    it = group_begin;
+                    if (!parse_ipv4_bytes(it, end, bytes + n)) {
+                        return invalid;
+                    }
+                    n += 4;
+                    break;
+                }
+                if (digits > 4) {
+                    return invalid;
+                }
+                bytes[n++] = static_cast<unsigned char>(group >> 8u);
+                bytes[n++] = static_cast<unsigned char>(group);
+
+                if (n == 16 || it == end || *it != colon) {
+                    break;
+                }
+                if (end - it >= 2 && it[1] == colon) {
+                    if (gap >= 0) {
+                        return invalid;
+                    }
+                    gap = n;
+                    it += 2;
+                    continue;
+                }
+                if (end - it < 2 || hex_digit_value(it[1]) < 0) {
+                    // A trailing ':' isn't a part of the address
+                    break;
+                }
+                ++it;
+            }
+
+            if (gap < 0) {
+                if (n != 16) {
+                    return invalid;
+                }
+                std::memcpy(val.bytes.data(), bytes, 16);
+            }
+            else {
+                if (n == 16) {
+                    return invalid;
+                }
+                const auto tail = static_cast<size_t>(n - gap);
+                val.bytes.fill(0);
+                std::memcpy(val.bytes.data(), bytes,
+                            static_cast<size_t>(gap));
+                std::memcpy(val.bytes.data() + 16 - tail, bytes + gap, tail);
+            }
+            return {it - s.data()};
+        }
+
+        // Reads the hex digits in `pattern` ('x'), and matches the other
+        // characters in it, into consecutive bytes of `out`
+        template <typename CharT>
+        bool parse_hex_pattern(const CharT* it,
+                               const char* pattern,
+                               size_t pattern_size,
+                               unsigned char* out)
+        {
+            for (size_t i = 0; i < pattern_size; ++i) {
+                if (pattern[i] != 'x') {
+                    if (it[i] != ascii_widen<CharT>(pattern[i])) {
+                        return false;
+                    }
+                    continue;
+                }
+                const auto hi = hex_digit_value(it[i]);
+                const auto lo = hex_digit_value(it[i + 1]);
+                if (hi < 0 || lo < 0) {
+                    return false;
+                }
+                *out++ = static_cast<unsigned char>(hi * 16 + lo);
+                ++i;
+            }
+            return true;
+        }
+
+        /**
+         * Reads "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx" from `p`.
+         * The digits are in fixed positions, so they're validated and
+         * converted 8 at a time.
+         */
+        inline bool parse_uuid_swar(const char* p, unsigned char* out)
+        {
+            std::uint64_t w[5];
+            // p[0..7]:   xxxxxxxx
+            // p[8..15]:  -xxxx-xx
+            // p[16..23]: xx-xxxx-
+            // p[24..31]: xxxxxxxx
+            // p[28..35]: xxxxxxxx
+            if (!address_swar_hex_pairs(swar_load(p), 0, 0, w[0]) ||
+                !address_swar_hex_pairs(swar_load(p + 8),
+                                        0x0000ff00000000ffull,
+                                        0x00002d000000002dull, w[1]) ||
+                !address_swar_hex_pairs(swar_load(p + 16),
+                                        0xff00000000ff0000ull,
+                                        0x2d000000002d0000ull, w[2]) ||
+                !address_swar_hex_pairs(swar_load(p + 24), 0, 0,
+                                        w[3]) ||
+                !address_swar_hex_pairs(swar_load(p + 28), 0, 0,
+                                        w[4])) {
+                return false;
+            }
+            const unsigned char bytes[16] = {
+                address_swar_byte(w[0], 0), address_swar_byte(w[0], 2),
+                address_swar_byte(w[0], 4), address_swar_byte(w[0], 6),
+                address_swar_byte(w[1], 1), address_swar_byte(w[1], 3),
+                address_swar_byte(w[1], 6), address_swar_byte(w[2], 0),
+                address_swar_byte(w[2], 3), address_swar_byte(w[2], 5),
+                address_swar_byte(w[3], 0), address_swar_byte(w[3], 2),
+                address_swar_byte(w[3], 4), address_swar_byte(w[3], 6),
+                address_swar_byte(w[4], 4), address_swar_byte(w[4], 6)};
+            std::memcpy(out, bytes, 16);
+            return true;
+        }
+
+        template <typename CharT>
+        bool parse_uuid_bytes(const CharT* p, unsigned char* out)
+        {
+            return parse_hex_pattern(p,
+                                     "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx",
+                                     36, out);
+        }
+        inline bool parse_uuid_bytes(const char* p, unsigned char* out)
+        {
+            return parse_uuid_swar(p, out);
+        }
+
+        template <typename CharT>
+        expected<std::ptrdiff_t> parse_address(span<const CharT> s, uuid& val)
+        {
+            if (s.size() < 36 ||
+                !parse_uuid_bytes(s.data(), val.bytes.data())) {
+                return error(error::invalid_scanned_value, "Invalid UUID");
+            }
+            return {36};
+        }
+
+        /**
+         * Reads "xx:xx:xx:xx:xx:xx" or "xx-xx-xx-xx-xx-xx" from `p`, 8
+         * characters at a time.
+         */
+        inline bool parse_mac_swar(const char* p, unsigned char* out)
+        {
+            const auto sep = static_cast<std::uint64_t>(
+                static_cast<unsigned char>(p[2]));
+            if ((sep != ':' && sep != '-') || p[8] != p[2]) {
+                return false;
+            }
+            // p[0..7]: xx:xx:xx, p[9..16]: xx:xx:xx
+            const auto sep_mask = 0x0000ff0000ff0000ull;
+            const auto seps = (sep << 16u) | (sep << 40u);
+            std::uint64_t w0{}, w1{};
+            if (!address_swar_hex_pairs(swar_load(p), sep_mask, seps,
+                                        w0) ||
+                !address_swar_hex_pairs(swar_load(p + 9), sep_mask,
+                                        seps, w1)) {
+                return false;
+            }
+            const unsigned char bytes[6] = {
+                address_swar_byte(w0, 0), address_swar_byte(w0, 3),
+                address_swar_byte(w0, 6), address_swar_byte(w1, 0),
+                address_swar_byte(w1, 3), address_swar_byte(w1, 6)};
+            std::memcpy(out, bytes, 6);
+            return true;
+        }
+
+        template <typename CharT>
+        bool parse_mac_bytes(const CharT* p, unsigned char* out)
+        {
+            return parse_hex_pattern(p, "xx:xx:xx:xx:xx:xx", 17, out) ||
+                   parse_hex_pattern(p, "xx-xx-xx-xx-xx-xx", 17, out);
+        }
+        inline bool parse_mac_bytes(const char* p, unsigned char* out)
+        {
+            return parse_mac_swar(p, out);
+        }
+
+        template <typename CharT>
+        expected<std::ptrdiff_t> parse_address(span<const CharT> s,
+                                               mac_address& val)
+        {
+            if (s.size() < 17 ||
+                !parse_mac_bytes(s.data(), val.bytes.data())) {
+                return error(error::invalid_scanned_value,
+                             "Invalid MAC address");
+            }
+            return {17};
+        }
+
+        /**
+         * Scanner for the address types in this header.
+         *
+         * With a contiguous source range, the address is parsed directly
+         * from it. Otherwise, the source is read into a buffer until the
+         * next whitespace character. In both cases, the characters after
+         * the address are left in the range.
+         */
+        template <typename T>
+        struct address_scanner : empty_parser {
+            template <typename Context>
+            error scan(T& val, Context& ctx)
+            {
+                using char_type = typename Context::char_type;
+
+                resource_string<char_type> buf{
+                    polymorphic_allocator<char_type>{ctx.resource()}};
+                span<const char_type> s{};
+                auto e = _read_source(
+                    ctx, buf, s,
+                    std::integral_constant<
+                        bool, Context::range_type::is_contiguous>{});
+                if (!e) {
+                    return e;
+                }
+
+                T tmp{};
+                auto ret = parse_address(s, tmp);
+                if (!ret) {
+                    return ret.error();
+                }
+                if (ret.value() != s.ssize()) {
+                    auto pb = putback_n(ctx.range(), s.ssize() - ret.value());
+                    if (!pb) {
+                        return pb;
+                    }
+                }
+                val = tmp;
+                return {};
+            }
+
+        private:
+            template <typename Context, typename Buf, typename CharT>
+            error _read_source(Context& ctx,
+                               Buf&,
+                               span<const CharT>& s,
+                               std::true_type)
+            {
+                auto ret = read_zero_copy(ctx.range(), ctx.range().size());
+                if (!ret) {
+                    return ret.error();
+                }
+                s = ret.value();
+                return {};
+            }
+            template <typename Context, typename Buf, typename CharT>
+            error _read_source(Context& ctx,
+                               Buf& buf,
+                               span<const CharT>& s,
+                               std::false_type)
+            {
+                auto outputit = std::back_inserter(buf);
+                auto e = read_until_space(
+                    ctx.range(), outputit,
+                    make_is_space_predicate(ctx.locale(), false), false);
+                if (!e && buf.empty()) {
+                    return e;
+                }
+                s = make_span(buf.data(), buf.size());
+                return {};
+            }
+        };
+    }  // namespace detail
+
+    template <>
+    struct scanner<ipv4_address> : detail::address_scanner<ipv4_address> {
+    };
+    template <>
+    struct scanner<ipv6_address> : detail::address_scanner<ipv6_address> {
+    };
+    template <>
+    struct scanner<uuid> : detail::address_scanner<uuid> {
+    };
+    template <>
+    struct scanner<mac_address> : detail::address_scanner<mac_address> {
+    };
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#endif  // SCN_READER_NETWORK_H
@@ -288,6 +288,9 @@ namespace scn {
                     }
                 }
 
+                if (get_option(flag::use_specifiers)) {
+                    specifier_ctype_mask = get_ctype_mask();
+                }
                 return {};
             }
 
@@ -307,52 +310,9 @@ namespace scn {
                     SCN_EXPECT(localized);  // ensured by sanitize()
                     SCN_UNUSED(localized);
                     SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
-                    if (get_option(specifier::alnum) &&
-                        loc.get_localized().is_alnum(ch)) {
-                        return not_inverted;
-                    }
-                    if (get_option(specifier::alpha) &&
-                        loc.get_localized().is_alpha(ch)) {
-                        return not_inverted;
-                    }
-                    if (get_option(specifier::blank) &&
-                        loc.get_localized().is_blank(ch)) {
-                        return not_inverted;
-                    }
-                    if (get_option(specifier::cntrl) &&
-                        loc.get_localized().is_cntrl(ch)) {
-                        return not_inverted;
-                    }
-                    if (get_option(specifier::digit) &&
-                        loc.get_localized().is_digit(ch)) {
-                        return not_inverted;
-                    }
-                    if (get_option(specifier::graph) &&
-                        loc.get_localized().is_graph(ch)) {
-                        return not_inverted;
-                    }
-                    if (get_option(specifier::lower) &&
-                        loc.get_localized().is_lower(ch)) {
-                        return not_inverted;
-                    }
-                    if (get_option(specifier::print) &&
-                        loc.get_localized().is_print(ch)) {
-                        return not_inverted;
-                    }
-                    if (get_option(specifier::punct) &&
-                        loc.get_localized().is_punct(ch)) {
-                        return not_inverted;
-                    }
-                    if (get_option(specifier::space) &&
-                        loc.get_localized().is_space(ch)) {
-                        return not_inverted;
-                    }
-                    if (get_option(specifier::upper) &&
-                        loc.get_localized().is_upper(ch)) {
-                        return not_inverted;
-                    }
-                    if (get_option(specifier::xdigit) &&
-                        loc.get_localized().is_xdigit(ch)) {
+                    // All specifiers are tested with a single lookup
+                    if (loc.get_localized().is_ctype(specifier_ctype_mask,
+                                                     ch)) {
                         return not_inverted;
                     }
                     SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
@@ -374,6 +334,33 @@ namespace scn {
                 return !not_inverted;
             }
 
+            /**
+             * Returns the specifiers set, as a combination of `ctype_mask`
+             * bits
+             */
+            SCN_NODISCARD uint16_t get_ctype_mask() const
+            {
+                uint16_t mask = 0;
+                auto set = [&](specifier s, uint16_t m) {
+                    if (get_option(s)) {
+                        mask = static_cast<uint16_t>(mask | m);
+                    }
+                };
+                set(specifier::alnum, ctype_alnum);
+                set(specifier::alpha, ctype_alpha);
+                set(specifier::blank, ctype_blank);
+                set(specifier::cntrl, ctype_cntrl);
+                set(specifier::digit, ctype_digit);
+                set(specifier::graph, ctype_graph);
+                set(specifier::lower, ctype_lower);
+                set(specifier::print, ctype_print);
+                set(specifier::punct, ctype_punct);
+                set(specifier::space, ctype_space);
+                set(specifier::upper, ctype_upper);
+                set(specifier::xdigit, ctype_xdigit);
+                return mask;
+            }
+
             enum class specifier : size_t {
                 alnum = 0x80,
                 alpha,
@@ -1041,6 +1028,8 @@ namespace scn {
             };
             // Used if set_options[use_ranges] = true
             small_vector<set_range, 1> set_extra_ranges{};
+            // Used if set_options[use_specifiers] = true, set by sanitize()
+            uint16_t specifier_ctype_mask{0};
         };
 
         struct string_scanner : common_parser {
@@ -1242,7 +1231,9 @@ namespace scn {
                     return {};
                 }
 
-                std::basic_string<typename Context::char_type> tmp;
+                resource_string<typename Context::char_type> tmp{
+                    polymorphic_allocator<typename Context::char_type>{
+                        ctx.resource()}};
                 auto outputit = std::back_inserter(tmp);
                 auto ret = read_until_space(ctx.range(), outputit,
                                             SCN_FWD(predicate), false);
@@ -1260,13 +1251,48 @@ namespace scn {
             }
         };
 
+        /**
+         * Pins the `n` characters that have just been read from `r`,
+         * starting from `start`.
+         * If they're in a single buffer of the range, they're pinned in
+         * place; only a value that straddles buffers is copied.
+         */
+        template <typename WrappedRange>
+        basic_string_view<typename WrappedRange::char_type> pin_read(
+            WrappedRange& r,
+            typename WrappedRange::iterator start,
+            std::ptrdiff_t n)
+        {
+            using char_type = typename WrappedRange::char_type;
+
+            auto s = get_buffer(r.range_underlying(), start,
+                                static_cast<size_t>(n));
+            if (s.ssize() == n) {
+                return r.pin_segment(s);
+            }
+
+            small_vector<char_type, 64> buf{};
+            while (n > 0) {
+                s = get_buffer(r.range_underlying(), start,
+                               static_cast<size_t>(n));
+                SCN_EXPECT(s.size() != 0);
+                for (auto ch : s) {
+                    buf.push_back(ch);
+                }
+                ranges::advance(start, s.ssize());
+                n -= s.ssize();
+            }
+            return r.pin_segment(make_span(buf.data(), buf.size()).as_const());
+        }
+
         struct string_view_scanner : string_scanner {
         public:
             template <typename Context>
             error scan(basic_string_view<typename Context::char_type>& val,
                        Context& ctx)
             {
-                if (!Context::range_type::is_contiguous) {
+                if (!Context::range_type::is_contiguous &&
+                    !Context::range_type::provides_pinned_segments) {
                     return {error::invalid_operation,
                             "Cannot read a string_view from a "
                             "non-contiguous_range"};
@@ -1299,8 +1325,20 @@ namespace scn {
                           basic_string_view<typename Context::char_type>& val,
                           Pred&& predicate)
             {
-                SCN_EXPECT(Context::range_type::is_contiguous);
+                return do_scan_impl(
+                    ctx, val, SCN_FWD(predicate),
+                    std::integral_constant<
+                        bool, Context::range_type::is_contiguous>{});
+            }
 
+        private:
+            template <typename Context, typename Pred>
+            error do_scan_impl(
+                Context& ctx,
+                basic_string_view<typename Context::char_type>& val,
+                Pred&& predicate,
+                std::true_type)
+            {
                 auto s = read_until_space_zero_copy(ctx.range(),
                                                     SCN_FWD(predicate), false);
                 if (!s) {
@@ -1314,6 +1352,134 @@ namespace scn {
                     s.value().data(), s.value().size());
                 return {};
             }
+
+            template <typename Context,
+                      typename Pred,
+                      typename std::enable_if<Context::range_type::
+                                                  provides_pinned_segments>::
+                          type* = nullptr>
+            error do_scan_impl(
+                Context& ctx,
+                basic_string_view<typename Context::char_type>& val,
+                Pred&& predicate,
+                std::false_type)
+            {
+                if (_scan_in_buffer(
+                        ctx, val, predicate,
+                        std::integral_constant<
+                            bool,
+                            Context::range_type::provides_stable_buffer>{})) {
+                    return {};
+                }
+
+                return _scan_and_pin(
+                    ctx, val, SCN_FWD(predicate),
+                    std::integral_constant<
+                        bool, Context::range_type::provides_buffer_access>{});
+            }
+
+            // The value is read through the buffer of the range, and pinned
+            // from there
+            template <typename Context, typename Pred>
+            static error _scan_and_pin(
+                Context& ctx,
+                basic_string_view<typename Context::char_type>& val,
+                Pred&& predicate,
+                std::true_type)
+            {
+                auto& r = ctx.range();
+                const auto start = r.begin();
+                ignore_iterator_n<typename Context::char_type> it{};
+                auto e = read_until_space(r, it, SCN_FWD(predicate), false);
+                if (!e) {
+                    return e;
+                }
+                if (it.i == 0) {
+                    return {error::invalid_scanned_value,
+                            "Empty string parsed"};
+                }
+                val = pin_read(r, start, it.i);
+                return {};
+            }
+            template <typename Context, typename Pred>
+            static error _scan_and_pin(
+                Context& ctx,
+                basic_string_view<typename Context::char_type>& val,
+                Pred&& predicate,
+                std::false_type)
+            {
+                small_vector<typename Context::char_type, 64> buf{};
+                auto it = std::back_inserter(buf);
+                auto e = read_until_space(ctx.range(), it, SCN_FWD(predicate),
+                                          false);
+                if (!e) {
+                    return e;
+                }
+                if (buf.empty()) {
+                    return {error::invalid_scanned_value,
+                            "Empty string parsed"};
+                }
+                val = ctx.range().pin_segment(
+                    make_span(buf.data(), buf.size()).as_const());
+                return {};
+            }
+            // If the value ends inside the buffer `begin()` points into,
+            // point `val` into it, instead of copying and pinning.
+            // `pred` is copied, so that it can be called again on the same
+            // characters when falling back.
+            template <typename Context, typename Pred>
+            static bool _scan_in_buffer(
+                Context& ctx,
+                basic_string_view<typename Context::char_type>& val,
+                const Pred& predicate,
+                std::true_type)
+            {
+                if (predicate.is_multibyte()) {
+                    return false;
+                }
+                auto& r = ctx.range();
+                auto buf = get_buffer(r.range_underlying(), r.begin());
+                auto pred = predicate;
+                auto it = buf.begin();
+                for (; it != buf.end(); ++it) {
+                    if (pred(make_span(it, 1))) {
+                        break;
+                    }
+                }
+                if (it == buf.begin() ||
+                    (it == buf.end() &&
+                     buf.ssize() != ranges::distance(r.begin(), r.end()))) {
+                    // empty, or may continue in the next buffer
+                    return false;
+                }
+                const auto n = it - buf.begin();
+                val = {buf.data(), static_cast<size_t>(n)};
+                r.advance(n);
+                return true;
+            }
+            template <typename Context, typename Pred>
+            static bool _scan_in_buffer(
+                Context&,
+                basic_string_view<typename Context::char_type>&,
+                const Pred&,
+                std::false_type)
+            {
+                return false;
+            }
+
+            template <typename Context,
+                      typename Pred,
+                      typename std::enable_if<!Context::range_type::
+                                                  provides_pinned_segments>::
+                          type* = nullptr>
+            error do_scan_impl(Context&,
+                               basic_string_view<typename Context::char_type>&,
+                               Pred&&,
+                               std::false_type)
+            {
+                SCN_EXPECT(false);
+                SCN_UNREACHABLE;
+            }
         };
 
 #if SCN_HAS_STRING_VIEW
@@ -18,6 +18,7 @@
 #ifndef SCN_READER_TYPES_H
 #define SCN_READER_TYPES_H
 
+#include "../util/small_vector.h"
 #include "int.h"
 
 namespace scn {
@@ -54,24 +55,114 @@ namespace scn {
             }
         };
 
+        /**
+         * The names accepted by `bool_scanner`, for one character type,
+         * sorted by their first character.
+         */
+        template <typename CharT>
+        struct bool_name_table {
+            struct entry {
+                basic_string_view<CharT> name;
+                uint32_t first;
+                bool value;
+                // Only the whole word matches, e.g. "f", but not "fish"
+                bool whole_word;
+            };
+
+            static uint32_t index(CharT ch) noexcept
+            {
+                return static_cast<uint32_t>(
+                    static_cast<typename std::make_unsigned<CharT>::type>(
+                        ch));
+            }
+
+            void clear() noexcept
+            {
+                count = 0;
+                max_size = 0;
+            }
+
+            void add(basic_string_view<CharT> name,
+                     bool value,
+                     bool whole_word = false)
+            {
+                if (name.size() == 0) {
+                    return;
+                }
+                // Keep the table sorted by the first character
+                auto e = entry{name, index(name[0]), value, whole_word};
+                auto i = count++;
+                for (; i != 0 && entries[i - 1].first > e.first; --i) {
+                    entries[i] = entries[i - 1];
+                }
+                entries[i] = e;
+                max_size = detail::max(max_size, name.size());
+            }
+
+            /**
+             * Matches `word` against the names starting with its first
+             * character.
+             * A name matches, if `word` starts with it, or, if the name is
+             * `whole_word`, if `word` is equal to it.
+             * The longest match wins.
+             */
+            const entry* match(span<const CharT> word) const
+            {
+                const entry* m = nullptr;
+                if (word.size() == 0) {
+                    return m;
+                }
+                const auto first = index(word[0]);
+
+                auto it = entries.begin();
+                const auto end = it + count;
+                while (it != end && it->first < first) {
+                    ++it;
+                }
+                for (; it != end && it->first == first; ++it) {
+                    const auto size = it->name.size();
+                    if (it->whole_word ? size != word.size()
+                                       : size > word.size()) {
+                        continue;
+                    }
+                    if (m && m->name.size() >= size) {
+                        continue;
+                    }
+                    if (std::equal(it->name.begin() + 1, it->name.end(),
+                                   word.begin() + 1)) {
+                        m = it;
+                    }
+                }
+                return m;
+            }
+
+            array<entry, 6> entries{};
+            size_t max_size{0};
+            uint8_t count{0};
+        };
+
         struct bool_scanner : common_parser {
             template <typename ParseCtx>
             error parse(ParseCtx& pctx)
             {
                 using char_type = typename ParseCtx::char_type;
 
-                array<char_type, 3> options{{
+                array<char_type, 5> options{{
                     // Only strings
                     ascii_widen<char_type>('s'),
                     // Only ints
                     ascii_widen<char_type>('i'),
                     // Localized digits
                     ascii_widen<char_type>('n'),
+                    // yes/no
+                    ascii_widen<char_type>('y'),
+                    // t/f
+                    ascii_widen<char_type>('t'),
                 }};
-                bool flags[3] = {false};
+                bool flags[5] = {false};
                 auto e = parse_common(
                     pctx, span<const char_type>{options.begin(), options.end()},
-                    span<bool>{flags, 3}, null_type_cb<ParseCtx>);
+                    span<bool>{flags, 5}, null_type_cb<ParseCtx>);
 
                 if (!e) {
                     return e;
@@ -79,7 +170,7 @@ namespace scn {
 
                 format_options = 0;
                 // default ('s' + 'i')
-                if (!flags[0] && !flags[1]) {
+                if (!flags[0] && !flags[1] && !flags[3] && !flags[4]) {
                     format_options |= allow_string | allow_int;
                 }
                 // 's'
@@ -96,6 +187,20 @@ namespace scn {
                     // 'n' implies 'L'
                     common_options |= localized;
                 }
+                // 'y'
+                if (flags[3]) {
+                    format_options |= allow_yes_no;
+                }
+                // 't'
+                if (flags[4]) {
+                    format_options |= allow_short;
+                }
+                // Localized names are looked up in scan(), from the locale
+                // of the context, so that a parsed scanner can be reused
+                m_names_built = false;
+                if ((common_options & localized) == 0) {
+                    build_names(pctx.locale());
+                }
                 return {};
             }
 
@@ -104,56 +209,15 @@ namespace scn {
             {
                 using char_type = typename Context::char_type;
 
-                if ((format_options & allow_string) != 0) {
-                    auto truename = ctx.locale().get_static().truename();
-                    auto falsename = ctx.locale().get_static().falsename();
-#if !SCN_DISABLE_LOCALE
-                    if ((common_options & localized) != 0) {
-                        truename = ctx.locale().get_localized().truename();
-                        falsename = ctx.locale().get_localized().falsename();
-                    }
-#endif
-                    const auto max_len =
-                        detail::max(truename.size(), falsename.size());
-                    std::basic_string<char_type> buf;
-                    buf.reserve(max_len);
-
-                    auto tmp_it = std::back_inserter(buf);
-                    auto is_space_pred = make_is_space_predicate(
-                        ctx.locale(), (common_options & localized) != 0,
-                        field_width);
-                    auto e = read_until_space(ctx.range(), tmp_it,
-                                              is_space_pred, false);
+                if ((format_options & any_name) != 0) {
+                    bool found = false;
+                    auto e = scan_names(val, ctx, found);
                     if (!e) {
                         return e;
                     }
-
-                    bool found = false;
-                    if (buf.size() >= falsename.size()) {
-                        if (std::equal(falsename.begin(), falsename.end(),
-                                       buf.begin())) {
-                            val = false;
-                            found = true;
-                        }
-                    }
-                    if (!found && buf.size() >= truename.size()) {
-                        if (std::equal(truename.begin(), truename.end(),
-                                       buf.begin())) {
-                            val = true;
-                            found = true;
-                        }
-                    }
                     if (found) {
                         return {};
                     }
-                    else {
-                        auto pb =
-                            putback_n(ctx.range(),
-                                      static_cast<std::ptrdiff_t>(buf.size()));
-                        if (!pb) {
-                            return pb;
-                        }
-                    }
                 }
 
                 if ((format_options & allow_int) != 0) {
@@ -184,23 +248,22 @@ namespace scn {
                     }
 #endif // !SCN_DISABLE_LOCALE
 
-                    unsigned char buf[4] = {0};
-                    auto cp = read_code_point(ctx.range(), make_span(buf, 4));
-                    if (!cp) {
-                        return cp.error();
+                    // '0' and '1' are always single-unit code points,
+                    // so there's no need to read a whole code point
+                    auto ch = read_code_unit(ctx.range(), false);
+                    if (!ch) {
+                        return ch.error();
                     }
-                    if (cp.value().cp == detail::ascii_widen<char_type>('0')) {
+                    if (ch.value() == detail::ascii_widen<char_type>('0')) {
+                        ctx.range().advance();
                         val = false;
                         return {};
                     }
-                    if (cp.value().cp == detail::ascii_widen<char_type>('1')) {
+                    if (ch.value() == detail::ascii_widen<char_type>('1')) {
+                        ctx.range().advance();
                         val = true;
                         return {};
                     }
-                    auto pb = putback_n(ctx.range(), cp.value().chars.ssize());
-                    if (!pb) {
-                        return pb;
-                    }
                 }
 
                 return {error::invalid_scanned_value, "Couldn't scan bool"};
@@ -212,9 +275,139 @@ namespace scn {
                 // 'i' option
                 allow_int = 2,
                 // 'n' option
-                localized_digits = 4
+                localized_digits = 4,
+                // 'y' option
+                allow_yes_no = 8,
+                // 't' option
+                allow_short = 16,
+                any_name = allow_string | allow_yes_no | allow_short
             };
             uint8_t format_options{allow_string | allow_int};
+
+        private:
+            SCN_NODISCARD static constexpr const char* yes_str(char)
+            {
+                return "yes";
+            }
+            SCN_NODISCARD static constexpr const wchar_t* yes_str(wchar_t)
+            {
+                return L"yes";
+            }
+            SCN_NODISCARD static constexpr const char* no_str(char)
+            {
+                return "no";
+            }
+            SCN_NODISCARD static constexpr const wchar_t* no_str(wchar_t)
+            {
+                return L"no";
+            }
+
+            bool_name_table<char>& names(char) noexcept
+            {
+                return m_narrow_names;
+            }
+            bool_name_table<wchar_t>& names(wchar_t) noexcept
+            {
+                return m_wide_names;
+            }
+
+            /**
+             * Builds the table of names selected by `format_options`.
+             * Called by `parse()`, or by `scan()`, if the scanner wasn't
+             * parsed, or if the names are localized.
+             */
+            template <typename Locale>
+            void build_names(const Locale& loc)
+            {
+                using char_type = typename Locale::char_type;
+                using string_view_type = basic_string_view<char_type>;
+
+                auto& table = names(char_type{});
+                table.clear();
+                if ((format_options & allow_string) != 0) {
+                    auto truename = loc.get_static().truename();
+                    auto falsename = loc.get_static().falsename();
+#if !SCN_DISABLE_LOCALE
+                    if ((common_options & localized) != 0) {
+                        truename = loc.get_localized().truename();
+                        falsename = loc.get_localized().falsename();
+                    }
+#endif
+                    table.add(truename, true);
+                    table.add(falsename, false);
+                }
+                if ((format_options & allow_yes_no) != 0) {
+                    table.add(string_view_type{yes_str(char_type{})}, true);
+                    table.add(string_view_type{no_str(char_type{})}, false);
+                }
+                if ((format_options & allow_short) != 0) {
+                    static constexpr char_type t = ascii_widen<char_type>('t');
+                    static constexpr char_type f = ascii_widen<char_type>('f');
+                    table.add(string_view_type{&t, 1}, true, true);
+                    table.add(string_view_type{&f, 1}, false, true);
+                }
+                m_names_built = true;
+            }
+
+            template <typename Context>
+            error scan_names(bool& val, Context& ctx, bool& found)
+            {
+                using char_type = typename Context::char_type;
+
+                if (!m_names_built) {
+                    build_names(ctx.locale());
+                }
+                const auto& table = names(char_type{});
+                auto is_space_pred = make_is_space_predicate(
+                    ctx.locale(), (common_options & localized) != 0,
+                    field_width);
+
+                if (Context::range_type::is_contiguous) {
+                    auto s = read_until_space_zero_copy(ctx.range(),
+                                                        is_space_pred, false);
+                    if (!s) {
+                        return s.error();
+                    }
+                    if (auto m = table.match(s.value())) {
+                        val = m->value;
+                        found = true;
+                        return {};
+                    }
+                    return putback_n(ctx.range(), s.value().ssize());
+                }
+
+                // Non-contiguous: read at most one character more than the
+                // longest name is long, so that a word longer than any name
+                // is told apart from a name
+                small_vector<char_type, 8> buf(table.max_size + 1);
+                auto it = buf.begin();
+                auto e = read_until_space_ranged(ctx.range(), it, buf.end(),
+                                                 is_space_pred, false);
+                if (!e) {
+                    return e;
+                }
+                auto word = make_span(buf.data(), static_cast<size_t>(
+                                                      it - buf.begin()))
+                                .as_const();
+                if (auto m = table.match(word)) {
+                    val = m->value;
+                    found = true;
+
+                    // Skip the rest of the word, like with contiguous ranges
+                    auto skip_it = basic_skipws_iterator<char_type>{};
+                    e = read_until_space(ctx.range(), skip_it, is_space_pred,
+                                         false);
+                    if (!e && e.code() != error::end_of_range) {
+                        return e;
+                    }
+                    return {};
+                }
+                return putback_n(ctx.range(), word.ssize());
+            }
+
+            bool_name_table<char> m_narrow_names{};
+            bool_name_table<wchar_t> m_wide_names{};
+            bool m_names_built{false};
         };
 
     }  // namespace detail
@@ -0,0 +1,465 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_SCAN_DELIMITED_H
+#define SCN_SCAN_DELIMITED_H
+
+#include "field.h"
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    /**
+     * Used to customize `basic_delimited_tokenizer`.
+     *
+     * `csv_options` and `tsv_options` can be used to create a value of this
+     * type.
+     */
+    template <typename CharT>
+    struct delimited_options {
+        /// Character separating fields in a record
+        CharT delimiter;
+        /**
+         * If set, a field beginning with this character is quoted: it ends
+         * at the next unescaped `quote`, and can contain delimiters and
+         * newlines.
+         * Inside a quoted field, two consecutive `quote`s stand for a single
+         * one.
+         */
+        optional<CharT> quote{};
+        /**
+         * If set, inside a quoted field, the character following `escape` is
+         * taken as-is.
+         */
+        optional<CharT> escape{};
+        /**
+         * If `true`, a <tt>'\\r'</tt> before the <tt>'\\n'</tt> ending a
+         * record is not included in the last field, so that
+         * <tt>"\\r\\n"</tt> line endings can be read.
+         */
+        bool strip_cr{true};
+
+        delimited_options(CharT d,
+                          optional<CharT> q = nullopt,
+                          optional<CharT> e = nullopt,
+                          bool cr = true)
+            : delimiter(d),
+              quote(SCN_MOVE(q)),
+              escape(SCN_MOVE(e)),
+              strip_cr(cr)
+        {
+        }
+    };
+
+    /**
+     * Create a `delimited_options` for comma-separated values (RFC 4180):
+     * fields separated by <tt>','</tt>, optionally quoted with <tt>'"'</tt>.
+     */
+    template <typename CharT = char>
+    delimited_options<CharT> csv_options()
+    {
+        return {detail::ascii_widen<CharT>(','),
+                optional<CharT>{detail::ascii_widen<CharT>('"')}};
+    }
+    /**
+     * Create a `delimited_options` for tab-separated values: fields
+     * separated by <tt>'\\t'</tt>, without quoting.
+     */
+    template <typename CharT = char>
+    delimited_options<CharT> tsv_options()
+    {
+        return {detail::ascii_widen<CharT>('\t')};
+    }
+
+    /**
+     * A field read by `basic_delimited_tokenizer`.
+     */
+    template <typename CharT>
+    struct basic_delimited_field {
+        /**
+         * Contents of the field, pointing into the source.
+         * For a quoted field, the surrounding quotes are not included.
+         */
+        basic_string_view<CharT> value{};
+        /// `true`, if the field was quoted
+        bool quoted{false};
+        /**
+         * `true`, if the field contains escape sequences, in which case
+         * `value` needs to be unescaped with
+         * `basic_delimited_tokenizer::unescape()` before use.
+         */
+        bool escaped{false};
+        /// `true`, if this was the last field in its record
+        bool end_of_record{false};
+    };
+
+    /**
+     * Splits a contiguous source range into records and fields of
+     * delimiter-separated values, e.g. CSV or TSV.
+     * Fields are returned as views into the source: no copies are made,
+     * unless a field needs to be unescaped.
+     *
+     * Records are separated by <tt>'\\n'</tt>.
+     * The end of a record and the next delimiter are searched for with
+     * `std::char_traits::find` (`memchr`/`wmemchr`).
+     *
+     * \code{.cpp}
+     * auto source = scn::string_view{"id,name,score\n1,\"Doe, J\",4.5\n"};
+     * auto tok = scn::delimited(source);
+     * tok.skip_record(); // header
+     * int id;
+     * std::string name;
+     * double score;
+     * while (!tok.at_end()) {
+     *     auto e = tok.read_record(id, name, score);
+     *     if (!e) {
+     *         // handle error
+     *     }
+     * }
+     * \endcode
+     *
+     * \see delimited
+     */
+    template <typename CharT>
+    class basic_delimited_tokenizer {
+    public:
+        using char_type = CharT;
+        using string_view_type = basic_string_view<CharT>;
+        using field_type = basic_delimited_field<CharT>;
+        using options_type = delimited_options<CharT>;
+
+        basic_delimited_tokenizer(span<const CharT> source, options_type o)
+            : m_pos(source.data()),
+              m_end(source.data() + source.size()),
+              m_record_end(m_pos),
+              m_options(SCN_MOVE(o))
+        {
+        }
+
+        /// `true`, if every field has been read
+        SCN_NODISCARD bool at_end() const noexcept
+        {
+            return m_pos == m_end && !m_in_record;
+        }
+
+        /// The part of the source that hasn't been read yet
+        SCN_NODISCARD span<const CharT> remaining() const noexcept
+        {
+            return {m_pos, m_end};
+        }
+
+        /**
+         * Reads the next field.
+         *
+         * \return The field read, `error::end_of_range` if `at_end()`, or
+         * `error::invalid_scanned_value` if a quoted field is malformed.
+         * A malformed quoted field is skipped along with the rest of its
+         * record, so that reading can continue from the next record.
+         */
+        expected<field_type> next_field()
+        {
+            if (at_end()) {
+                return error(error::end_of_range, "EOF");
+            }
+            if (!m_in_record) {
+                m_record_end = _find_newline(m_pos);
+                m_in_record = true;
+            }
+
+            field_type f{};
+            if (m_options.quote && m_pos != m_record_end &&
+                *m_pos == *m_options.quote) {
+                auto e = _read_quoted(f);
+                if (!e) {
+                    _end_record();
+                    return e;
+                }
+            }
+            else {
+                auto p = std::char_traits<CharT>::find(
+                    m_pos, static_cast<size_t>(m_record_end - m_pos),
+                    m_options.delimiter);
+                auto field_end = p ? p : m_record_end;
+                f.value = string_view_type{
+                    m_pos, static_cast<size_t>(field_end - m_pos)};
+                m_pos = field_end;
+                if (!p && m_options.strip_cr && f.value.size() != 0 &&
+                    f.value[f.value.size() - 1] ==
+                        detail::ascii_widen<CharT>('\r')) {
+                    f.value.remove_suffix(1);
+                }
+            }
+
+            if (m_pos != m_record_end) {
+                // delimiter
+                ++m_pos;
+                return {f};
+            }
+            f.end_of_record = true;
+            m_in_record = false;
+            if (m_pos != m_end) {
+                // newline
+                ++m_pos;
+            }
+            return {f};
+        }
+
+        /**
+         * Skips over the rest of the current record, or the next record, if
+         * the previous field read was the last one in its record.
+         */
+        error skip_record()
+        {
+            do {
+                auto f = next_field();
+                if (!f) {
+                    return f.error();
+                }
+                if (f.value().end_of_record) {
+                    return {};
+                }
+            } while (true);
+        }
+
+        /**
+         * Reads a record, and scans every field in it into the respective
+         * `a`.
+         *
+         * A field is scanned into a `std::basic_string<CharT>` as-is, and
+         * into a `basic_string_view<CharT>` without copying, if possible.
+         * Otherwise, the field is scanned with the scanner for its type,
+         * directly, with the default options: the field must contain only
+         * the value scanned, and whitespace.
+         *
+         * If the record contains more fields than arguments given, the rest
+         * are skipped.
+         *
+         * \return `error::invalid_scanned_value` if the record has fewer
+         * fields than arguments given, or if a field couldn't be scanned,
+         * or if a field not scanned into a string is empty or blank.
+         * Other errors from `next_field()` are passed through.
+         * After an error, the rest of the record is skipped; if that fails,
+         * e.g. because of an unterminated quoted field, that error is
+         * returned instead.
+         */
+        template <typename... Args>
+        error read_record(Args&... a)
+        {
+            bool end_of_record = false;
+            auto e = _read_fields(end_of_record, a...);
+            if (!e) {
+                if (m_in_record) {
+                    auto skipped = skip_record();
+                    if (!skipped) {
+                        return skipped;
+                    }
+                }
+                return e;
+            }
+            if (!end_of_record) {
+                return skip_record();
+            }
+            return {};
+        }
+
+        /**
+         * Writes the contents of `f` into `str`, with escape sequences
+         * replaced with the characters they stand for.
+         *
+         * `String` must have member functions `clear()` and `push_back()`.
+         */
+        template <typename String>
+        void unescape(const field_type& f, String& str) const
+        {
+            str.clear();
+            const auto& v = f.value;
+            for (size_t i = 0; i < v.size(); ++i) {
+                if (f.escaped && i + 1 < v.size() &&
+                    ((m_options.escape && v[i] == *m_options.escape) ||
+                     (m_options.quote && v[i] == *m_options.quote))) {
+                    ++i;
+                }
+                str.push_back(v[i]);
+            }
+        }
+
+        SCN_NODISCARD const options_type& options() const noexcept
+        {
+            return m_options;
+        }
+
+    private:
+        const CharT* _find_newline(const CharT* p) const noexcept
+        {
+            auto n = std::char_traits<CharT>::find(
+                p, static_cast<size_t>(m_end - p),
+                detail::ascii_widen<CharT>('\n'));
+            return n ? n : m_end;
+        }
+
+        // Skips to the end of the current record, on an error
+        void _end_record() noexcept
+        {
+            m_pos = m_record_end;
+            m_in_record = false;
+            if (m_pos != m_end) {
+                // newline
+                ++m_pos;
+            }
+        }
+
+        error _read_quoted(field_type& f)
+        {
+            const auto quote = *m_options.quote;
+            const bool has_escape =
+                m_options.escape && *m_options.escape != quote;
+            auto p = m_pos + 1;
+            while (true) {
+                if (has_escape) {
+                    while (p != m_end && *p != quote &&
+                           *p != *m_options.escape) {
+                        ++p;
+                    }
+                    if (p != m_end && *p == *m_options.escape) {
+                        if (p + 1 == m_end) {
+                            p = m_end;
+                        }
+                        else {
+                            f.escaped = true;
+                            p += 2;
+                            continue;
+                        }
+                    }
+                }
+                else {
+                    p = std::char_traits<CharT>::find(
+                        p, static_cast<size_t>(m_end - p), quote);
+                    if (!p) {
+                        p = m_end;
+                    }
+                }
+                if (p == m_end) {
+                    return {error::invalid_scanned_value,
+                            "Unterminated quoted field"};
+                }
+                if (p + 1 != m_end && *(p + 1) == quote) {
+                    f.escaped = true;
+                    p += 2;
+                    continue;
+                }
+                break;
+            }
+
+            auto next = p + 1;
+            auto record_end = m_record_end;
+            if (p >= record_end) {
+                // a newline inside the quotes
+                record_end = _find_newline(next);
+            }
+            if (m_options.strip_cr && next != record_end &&
+                *next == detail::ascii_widen<CharT>('\r') &&
+                next + 1 == record_end) {
+                ++next;
+            }
+            if (next != record_end && *next != m_options.delimiter) {
+                m_record_end = record_end;
+                return {error::invalid_scanned_value,
+                        "Unexpected character after a quoted field"};
+            }
+
+            f.value = string_view_type{
+                m_pos + 1, static_cast<size_t>(p - (m_pos + 1))};
+            f.quoted = true;
+            m_pos = next;
+            m_record_end = record_end;
+            return {};
+        }
+
+        error _read_fields(bool&)
+        {
+            return {};
+        }
+        template <typename T, typename... Args>
+        error _read_fields(bool& end_of_record, T& val, Args&... a)
+        {
+            if (end_of_record) {
+                return {error::invalid_scanned_value,
+                        "Too few fields in record"};
+            }
+            auto f = next_field();
+            if (!f) {
+                return f.error();
+            }
+            end_of_record = f.value().end_of_record;
+            auto e = _scan_field(f.value(), val);
+            if (!e) {
+                return e;
+            }
+            return _read_fields(end_of_record, a...);
+        }
+
+        template <typename T>
+        error _scan_field(const field_type& f, T& val)
+        {
+            if (!f.escaped) {
+                return detail::scan_field(f.value, val);
+            }
+            if (std::is_same<T, string_view_type>::value) {
+                return {error::invalid_scanned_value,
+                        "Cannot scan an escaped field into a string_view"};
+            }
+            unescape(f, m_unescaped);
+            return detail::scan_field(
+                string_view_type{m_unescaped.data(), m_unescaped.size()},
+                val);
+        }
+
+        const CharT* m_pos;
+        const CharT* m_end;
+        const CharT* m_record_end;
+        options_type m_options;
+        std::basic_string<CharT> m_unescaped{};
+        bool m_in_record{false};
+    };
+
+    using delimited_tokenizer = basic_delimited_tokenizer<char>;
+    using wdelimited_tokenizer = basic_delimited_tokenizer<wchar_t>;
+
+    /**
+     * Returns a `basic_delimited_tokenizer` over `r`, which must be a
+     * contiguous range, e.g. a `string_view` or a `mapped_file`.
+     * The returned tokenizer points into `r`.
+     *
+     * \param o Options, defaulting to `csv_options()`
+     */
+    template <typename Range,
+              typename CharT = ranges::range_value_t<const Range>,
+              typename std::enable_if<
+                  SCN_CHECK_CONCEPT(ranges::contiguous_range<const Range>) &&
+                  SCN_CHECK_CONCEPT(ranges::sized_range<const Range>)>::type* =
+                  nullptr>
+    basic_delimited_tokenizer<CharT> delimited(
+        const Range& r,
+        delimited_options<CharT> o = csv_options<CharT>())
+    {
+        return {detail::records_source(r), SCN_MOVE(o)};
+    }
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#endif  // SCN_SCAN_DELIMITED_H
@@ -0,0 +1,610 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_SCAN_DESCRIBE_H
+#define SCN_SCAN_DESCRIBE_H
+
+#include "scan.h"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Preprocessor helpers for SCN_DESCRIBE, up to 32 members
+
+#define SCN_DESCRIBE_EXPAND(x) x
+#define SCN_DESCRIBE_CAT_APPLY(a, b) a##b
+#define SCN_DESCRIBE_CAT(a, b) SCN_DESCRIBE_CAT_APPLY(a, b)
+#define SCN_DESCRIBE_COUNT_IMPL(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, \
+    _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, \
+    _25, _26, _27, _28, _29, _30, _31, _32, N, ...) N
+#define SCN_DESCRIBE_COUNT(...) \
+    SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_COUNT_IMPL(__VA_ARGS__, 32, 31, 30, \
+        29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, \
+        12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1))
+
+#define SCN_DESCRIBE_MEMBERS_1(T, m) &T::m
+#define SCN_DESCRIBE_MEMBERS_2(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_1(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_3(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_2(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_4(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_3(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_5(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_4(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_6(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_5(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_7(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_6(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_8(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_7(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_9(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_8(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_10(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_9(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_11(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_10(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_12(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_11(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_13(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_12(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_14(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_13(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_15(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_14(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_16(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_15(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_17(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_16(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_18(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_17(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_19(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_18(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_20(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_19(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_21(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_20(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_22(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_21(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_23(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_22(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_24(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_23(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_25(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_24(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_26(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_25(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_27(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_26(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_28(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_27(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_29(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_28(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_30(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_29(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_31(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_30(T, __VA_ARGS__))
+#define SCN_DESCRIBE_MEMBERS_32(T, m, ...) \
+    &T::m, SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_MEMBERS_31(T, __VA_ARGS__))
+
+/**
+ * Describes the members of the class `T`, in the order they're scanned in,
+ * so that values of type `T` can be scanned directly into those members.
+ * By default, the members are separated by whitespace, like with
+ * `scan_default`: see `SCN_DESCRIBE_FORMAT` for setting another format.
+ *
+ * Must be used in the namespace of `T`, so that the generated function can
+ * be found with argument-dependent lookup.
+ * At most 32 members can be described.
+ *
+ * \code{.cpp}
+ * namespace app {
+ *     struct record {
+ *         int id;
+ *         std::string name;
+ *         double score;
+ *     };
+ *     SCN_DESCRIBE(record, id, name, score)
+ * }
+ *
+ * app::record r;
+ * auto ret = scn::scan_default("1 foo 4.5", r);
+ *
+ * std::vector<app::record> records;
+ * ret = scn::scan_list("1 foo 4.5\n2 bar 3.5\n", records);
+ * \endcode
+ */
+#define SCN_DESCRIBE(T, ...)                                                  \
+    inline auto scn_describe_members(const T*) -> decltype(::std::make_tuple( \
+        SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_CAT(                                 \
+            SCN_DESCRIBE_MEMBERS_,                                            \
+            SCN_DESCRIBE_COUNT(__VA_ARGS__))(T, __VA_ARGS__))))               \
+    {                                                                         \
+        return ::std::make_tuple(SCN_DESCRIBE_EXPAND(SCN_DESCRIBE_CAT(        \
+            SCN_DESCRIBE_MEMBERS_,                                            \
+            SCN_DESCRIBE_COUNT(__VA_ARGS__))(T, __VA_ARGS__)));               \
+    }
+
+/**
+ * Sets the format of the class `T`, described with `SCN_DESCRIBE`.
+ *
+ * `fmt` is a narrow, ASCII string literal, with a replacement field for
+ * every described member, in order, which may contain format specifiers
+ * for that member. Argument ids aren't supported.
+ * Like with `scan`, literal characters in `fmt` must be matched by the
+ * source, and whitespace skips any amount of whitespace.
+ *
+ * The format is compiled once, when a `T` is first scanned.
+ *
+ * \code{.cpp}
+ * namespace app {
+ *     struct point {
+ *         int x, y;
+ *     };
+ *     SCN_DESCRIBE(point, x, y)
+ *     SCN_DESCRIBE_FORMAT(point, "[{}, {:x}]")
+ * }
+ *
+ * app::point p;
+ * auto ret = scn::scan_default("[1, ff]", p);
+ * // p.x == 1, p.y == 255
+ * \endcode
+ */
+#define SCN_DESCRIBE_FORMAT(T, fmt)                  \
+    inline const char* scn_describe_format(const T*) \
+    {                                                \
+        return fmt;                                  \
+    }
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    namespace detail {
+        template <typename T>
+        struct is_described_impl {
+            template <typename U>
+            static auto test(int) -> decltype(
+                scn_describe_members(static_cast<const U*>(nullptr)),
+                std::true_type{});
+            template <typename>
+            static std::false_type test(...);
+
+            using type = decltype(test<T>(0));
+        };
+        /// `true`, if `T` has been described with `SCN_DESCRIBE`
+        template <typename T>
+        struct is_described : is_described_impl<T>::type {
+        };
+
+        template <typename T>
+        struct has_described_format_impl {
+            template <typename U>
+            static auto test(int) -> decltype(
+                scn_describe_format(static_cast<const U*>(nullptr)),
+                std::true_type{});
+            template <typename>
+            static std::false_type test(...);
+
+            using type = decltype(test<T>(0));
+        };
+        /// `true`, if `T` has a format set with `SCN_DESCRIBE_FORMAT`
+        template <typename T>
+        struct has_described_format : has_described_format_impl<T>::type {
+        };
+
+        template <typename T>
+        const char* described_format(std::true_type)
+        {
+            return scn_describe_format(static_cast<const T*>(nullptr));
+        }
+        template <typename T>
+        const char* described_format(std::false_type)
+        {
+            return nullptr;
+        }
+
+        template <typename P>
+        struct member_pointer_value;
+        template <typename C, typename M>
+        struct member_pointer_value<M C::*> {
+            using type = M;
+        };
+
+        template <typename Members>
+        struct described_member_types;
+        template <typename... P>
+        struct described_member_types<std::tuple<P...>> {
+            using values_type =
+                std::tuple<typename member_pointer_value<P>::type...>;
+            using scanners_type =
+                std::tuple<scanner<typename member_pointer_value<P>::type>...>;
+        };
+
+        /**
+         * The format of a described type `T`, for scanning from a source
+         * of `CharT`, compiled once with `get()`.
+         *
+         * The format string is split into the literal characters and
+         * whitespace before, between and after the members, and the
+         * scanners of the members are parsed with their format specifiers.
+         */
+        template <typename T, typename CharT>
+        struct described_layout {
+            using members_type = decltype(scn_describe_members(
+                static_cast<const T*>(nullptr)));
+            using values_type =
+                typename described_member_types<members_type>::values_type;
+            using scanners_type =
+                typename described_member_types<members_type>::scanners_type;
+
+            static constexpr size_t member_count =
+                std::tuple_size<members_type>::value;
+
+            // A run of literal characters in `format`, or whitespace to skip,
+            // if `size == 0`
+            struct segment {
+                size_t offset;
+                size_t size;
+            };
+
+            static const described_layout& get()
+            {
+                static const described_layout layout{};
+                return layout;
+            }
+
+            described_layout()
+            {
+                parse_error = _compile(described_format<T>(
+                    typename has_described_format<T>::type{}));
+            }
+
+            template <typename Context>
+            error match_gap(Context& ctx, size_t i) const
+            {
+                for (const auto& seg : gaps[i]) {
+                    if (seg.size == 0) {
+                        auto e = skip_range_whitespace(ctx, false);
+                        if (!e && e != error::end_of_range) {
+                            return e;
+                        }
+                        continue;
+                    }
+                    auto e = _match_literal(
+                        ctx.range(),
+                        span<const CharT>{format.data() + seg.offset,
+                                          seg.size},
+                        std::integral_constant<
+                            bool, Context::range_type::
+                                      provides_buffer_access>{});
+                    if (!e) {
+                        return e;
+                    }
+                }
+                return {};
+            }
+
+            std::basic_string<CharT> format{};
+            std::vector<segment> gaps[member_count + 1];
+            scanners_type scanners{};
+            error parse_error{};
+
+        private:
+            template <size_t I, size_t N>
+            struct parse_scanners {
+                static error parse(described_layout& l,
+                                   const segment* fields)
+                {
+                    auto pctx = basic_parse_context<CharT>{
+                        basic_string_view<CharT>{
+                            l.format.data() + fields[I].offset,
+                            fields[I].size},
+                        l.m_locale};
+                    if (pctx.has_arg_id()) {
+                        return {error::invalid_format_string,
+                                "Argument ids are not supported in the "
+                                "format of a described type"};
+                    }
+                    auto e = pctx.parse(std::get<I>(l.scanners));
+                    if (!e) {
+                        return e;
+                    }
+                    if (!pctx || !pctx.check_arg_end()) {
+                        return {error::invalid_format_string,
+                                "Expected argument end"};
+                    }
+                    return parse_scanners<I + 1, N>::parse(l, fields);
+                }
+            };
+            template <size_t N>
+            struct parse_scanners<N, N> {
+                static error parse(described_layout&, const segment*)
+                {
+                    return {};
+                }
+            };
+
+            error _compile(const char* f)
+            {
+                segment fields[member_count + 1] = {};
+                size_t member = 0;
+
+                if (!f) {
+                    // Members separated by whitespace
+                    format.push_back(ascii_widen<CharT>('{'));
+                    format.push_back(ascii_widen<CharT>('}'));
+                    for (size_t i = 0; i < member_count; ++i) {
+                        fields[i] = {0, 2};
+                        if (i != 0) {
+                            gaps[i].push_back({0, 0});
+                        }
+                    }
+                    return parse_scanners<0, member_count>::parse(*this,
+                                                                  fields);
+                }
+
+                for (; *f; ++f) {
+                    format.push_back(ascii_widen<CharT>(*f));
+                }
+                const auto is_space = [](CharT ch) {
+                    return ch == ascii_widen<CharT>(' ') ||
+                           (ch >= ascii_widen<CharT>('\t') &&
+                            ch <= ascii_widen<CharT>('\r'));
+                };
+                const auto open = ascii_widen<CharT>('{');
+                const auto close = ascii_widen<CharT>('}');
+
+                size_t i = 0;
+                while (i < format.size()) {
+                    const auto ch = format[i];
+                    if (is_space(ch)) {
+                        gaps[member].push_back({i, 0});
+                        while (i < format.size() && is_space(format[i])) {
+                            ++i;
+                        }
+                        continue;
+                    }
+                    if (ch == open || ch == close) {
+                        if (i + 1 < format.size() && format[i + 1] == ch) {
+                            // Escaped brace
+                            gaps[member].push_back({i + 1, 1});
+                            i += 2;
+                            continue;
+                        }
+                        if (ch == close) {
+                            return {error::invalid_format_string,
+                                    "Unmatched '}' in format string"};
+                        }
+                        const auto end = format.find(close, i);
+                        if (end == std::basic_string<CharT>::npos) {
+                            return {error::invalid_format_string,
+                                    "Unexpected end of format argument"};
+                        }
+                        if (member == member_count) {
+                            return {error::invalid_format_string,
+                                    "More replacement fields than described "
+                                    "members in format string"};
+                        }
+                        fields[member++] = {i, end - i + 1};
+                        i = end + 1;
+                        continue;
+                    }
+
+                    auto run_end = i + 1;
+                    while (run_end < format.size() &&
+                           format[run_end] != open &&
+                           format[run_end] != close &&
+                           !is_space(format[run_end])) {
+                        ++run_end;
+                    }
+                    gaps[member].push_back({i, run_end - i});
+                    i = run_end;
+                }
+                if (member != member_count) {
+                    return {error::invalid_format_string,
+                            "Fewer replacement fields than described members "
+                            "in format string"};
+                }
+                return parse_scanners<0, member_count>::parse(*this, fields);
+            }
+
+            template <typename WrappedRange>
+            static error _match_literal(WrappedRange& r,
+                                        span<const CharT> lit,
+                                        std::true_type)
+            {
+                return match_literal_run(r, lit);
+            }
+            template <typename WrappedRange>
+            static error _match_literal(WrappedRange& r,
+                                        span<const CharT> lit,
+                                        std::false_type)
+            {
+                for (auto ch : lit) {
+                    auto cu = read_code_unit(r);
+                    if (!cu) {
+                        return cu.error();
+                    }
+                    if (cu.value() != ch) {
+                        return {error::invalid_scanned_value,
+                                "Expected character from format string not "
+                                "found in the stream"};
+                    }
+                }
+                return {};
+            }
+
+            // Only used for parsing: scanners don't keep a reference to it
+            basic_locale_ref<CharT> m_locale{};
+        };
+
+        template <typename Scanner, typename T, typename Context>
+        struct is_const_scanner_impl {
+            template <typename S>
+            static auto test(int) -> decltype(
+                std::declval<const S&>().scan(std::declval<T&>(),
+                                              std::declval<Context&>()),
+                std::declval<const S&>().skip_preceding_whitespace(),
+                std::true_type{});
+            template <typename>
+            static std::false_type test(...);
+
+            using type = decltype(test<Scanner>(0));
+        };
+        /// `true`, if a `Scanner` can scan a `T` without modifying itself
+        template <typename Scanner, typename T, typename Context>
+        struct is_const_scanner
+            : is_const_scanner_impl<Scanner, T, Context>::type {
+        };
+
+        template <typename Context, typename Scanner, typename T>
+        error scan_described_member(Context& ctx, Scanner& s, T& val)
+        {
+            using scanner_type = typename std::remove_const<Scanner>::type;
+            if (s.skip_preceding_whitespace()) {
+                auto e = skip_range_whitespace(ctx, false);
+                if (!e) {
+                    return e;
+                }
+            }
+            auto e = skip_alignment(ctx, s, false,
+                                    scanner_supports_alignment<scanner_type>{});
+            if (!e) {
+                return e;
+            }
+            e = s.scan(val, ctx);
+            if (!e) {
+                return e;
+            }
+            return skip_alignment(ctx, s, true,
+                                  scanner_supports_alignment<scanner_type>{});
+        }
+        // Scanners of the layout are shared: use them as-is, if they can
+        // scan without modifying themselves, and a copy otherwise
+        template <typename Context, typename Scanner, typename T>
+        error scan_described_member(Context& ctx,
+                                    const Scanner& s,
+                                    T& val,
+                                    std::true_type)
+        {
+            return scan_described_member(ctx, s, val);
+        }
+        template <typename Context, typename Scanner, typename T>
+        error scan_described_member(Context& ctx,
+                                    const Scanner& parsed,
+                                    T& val,
+                                    std::false_type)
+        {
+            auto s = parsed;
+            return scan_described_member(ctx, s, val);
+        }
+
+        template <size_t I, size_t N>
+        struct scan_described_members {
+            template <typename Context, typename Layout, typename Values>
+            static error scan(Context& ctx,
+                              const Layout& layout,
+                              Values& values)
+            {
+                auto e = layout.match_gap(ctx, I);
+                if (!e) {
+                    return e;
+                }
+
+                using value_type =
+                    typename std::tuple_element<I, Values>::type;
+                using scanner_type = typename std::tuple_element<
+                    I, typename Layout::scanners_type>::type;
+                e = scan_described_member(
+                    ctx, std::get<I>(layout.scanners), std::get<I>(values),
+                    typename is_const_scanner<scanner_type, value_type,
+                                              Context>::type{});
+                if (!e) {
+                    return e;
+                }
+                return scan_described_members<I + 1, N>::scan(ctx, layout,
+                                                              values);
+            }
+
+            template <typename T, typename Members, typename Values>
+            static void assign(T& val, const Members& members, Values& values)
+            {
+                val.*std::get<I>(members) = SCN_MOVE(std::get<I>(values));
+                scan_described_members<I + 1, N>::assign(val, members,
+                                                         values);
+            }
+        };
+        template <size_t N>
+        struct scan_described_members<N, N> {
+            template <typename Context, typename Layout, typename Values>
+            static error scan(Context& ctx, const Layout& layout, Values&)
+            {
+                return layout.match_gap(ctx, N);
+            }
+
+            template <typename T, typename Members, typename Values>
+            static void assign(T&, const Members&, Values&)
+            {
+            }
+        };
+    }  // namespace detail
+
+    /**
+     * Scanner for types described with `SCN_DESCRIBE`.
+     *
+     * The format of the type, set with `SCN_DESCRIBE_FORMAT`, or members
+     * separated by whitespace by default, is compiled once for every
+     * character type: the members are then scanned one after another, with
+     * scanners parsed beforehand.
+     *
+     * The members are scanned into temporaries, and assigned to only if
+     * every one of them was scanned successfully.
+     */
+    template <typename T>
+    struct scanner<
+        T,
+        typename std::enable_if<detail::is_described<T>::value>::type>
+        : public empty_parser {
+        template <typename Context>
+        error scan(T& val, Context& ctx) const
+        {
+            using layout_type =
+                detail::described_layout<T, typename Context::char_type>;
+            constexpr auto n = layout_type::member_count;
+
+            const auto& layout = layout_type::get();
+            if (!layout.parse_error) {
+                return layout.parse_error;
+            }
+
+            typename layout_type::values_type values{};
+            auto e = detail::scan_described_members<0, n>::scan(ctx, layout,
+                                                                values);
+            if (!e) {
+                return e;
+            }
+            detail::scan_described_members<0, n>::assign(
+                val, scn_describe_members(static_cast<const T*>(nullptr)),
+                values);
+            return {};
+        }
+    };
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#endif  // SCN_SCAN_DESCRIBE_H
@@ -0,0 +1,103 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_SCAN_FIELD_H
+#define SCN_SCAN_FIELD_H
+
+#include "scan.h"
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    namespace detail {
+        /**
+         * Scans a field, sliced from a record by `basic_delimited_tokenizer`
+         * or `basic_fixed_width_reader`, into `val`.
+         *
+         * Strings take the field as-is: a `std::basic_string` is assigned
+         * to, and a `basic_string_view` points to the field.
+         * Otherwise, the scanner for `T` is called directly on the field,
+         * like with `scan_default`, and the field must contain only the value
+         * scanned, and whitespace.
+         *
+         * \return `error::invalid_scanned_value`, if the field is empty or
+         * blank, or if it couldn't be scanned.
+         */
+        template <typename CharT, typename Traits, typename Allocator>
+        error scan_field(basic_string_view<CharT> f,
+                         std::basic_string<CharT, Traits, Allocator>& val)
+        {
+            val.assign(f.data(), f.size());
+            return {};
+        }
+        template <typename CharT>
+        error scan_field(basic_string_view<CharT> f,
+                         basic_string_view<CharT>& val)
+        {
+            val = f;
+            return {};
+        }
+        template <typename CharT, typename T>
+        error scan_field(basic_string_view<CharT> f, T& val)
+        {
+            using type_tag = get_type<CharT, T>;
+
+            auto ctx = make_context(wrap(f));
+            auto pctx = make_parse_context(1, ctx.locale());
+            auto e = scan_single_arg(
+                ctx, pctx, val,
+                std::integral_constant<bool, type_tag::value ==
+                                                 custom_type>{});
+            if (!e) {
+                if (e == error::end_of_range) {
+                    return {error::invalid_scanned_value, "Empty field"};
+                }
+                return e;
+            }
+            for (auto it = ctx.range().begin(); it != ctx.range().end();
+                 ++it) {
+                if (!is_space(*it)) {
+                    return {error::invalid_scanned_value,
+                            "Unexpected characters after a value in a field"};
+                }
+            }
+            return {};
+        }
+
+        /**
+         * The contents of a contiguous source range of records, as taken by
+         * `delimited()` and `fixed_width()`.
+         * A string literal doesn't include its null terminator.
+         */
+        template <typename Range,
+                  typename CharT = ranges::range_value_t<const Range>>
+        span<const CharT> records_source(const Range& r)
+        {
+            return {ranges::data(r), static_cast<size_t>(ranges::size(r))};
+        }
+        template <typename CharT, size_t N>
+        span<const CharT> records_source(const CharT (&r)[N])
+        {
+            static_assert(N != 0, "");
+            return {r, N - 1};
+        }
+    }  // namespace detail
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#endif  // SCN_SCAN_FIELD_H
@@ -0,0 +1,358 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_SCAN_FIXED_WIDTH_H
+#define SCN_SCAN_FIXED_WIDTH_H
+
+#include "field.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    /**
+     * A column in a `fixed_width_layout`: `width` code units, starting at
+     * `offset` from the beginning of a record.
+     */
+    struct fixed_width_column {
+        size_t offset;
+        size_t width;
+    };
+
+    /**
+     * Describes the columns of a fixed-width record format.
+     * Columns can be given in any order, and they may overlap or leave gaps.
+     *
+     * \code{.cpp}
+     * // chars 0-9: id, 10-17: amount
+     * auto layout = scn::fixed_width_layout{{0, 10}, {10, 8}};
+     * // the same, from consecutive column widths
+     * auto layout2 = scn::fixed_width_layout::from_widths({10, 8});
+     * \endcode
+     */
+    class fixed_width_layout {
+    public:
+        fixed_width_layout(std::initializer_list<fixed_width_column> columns)
+            : m_columns(columns)
+        {
+            _init();
+        }
+        template <typename InputIt>
+        fixed_width_layout(InputIt first, InputIt last)
+            : m_columns(first, last)
+        {
+            _init();
+        }
+
+        /**
+         * Create a layout of consecutive columns, with the given widths,
+         * starting from the beginning of a record.
+         */
+        static fixed_width_layout from_widths(
+            std::initializer_list<size_t> widths)
+        {
+            std::vector<fixed_width_column> columns;
+            columns.reserve(widths.size());
+            size_t offset = 0;
+            for (auto w : widths) {
+                columns.push_back({offset, w});
+                offset += w;
+            }
+            return {columns.begin(), columns.end()};
+        }
+
+        /// Number of columns
+        SCN_NODISCARD size_t size() const noexcept
+        {
+            return m_columns.size();
+        }
+        SCN_NODISCARD const fixed_width_column& operator[](
+            size_t i) const noexcept
+        {
+            SCN_EXPECT(i < size());
+            return m_columns[i];
+        }
+        SCN_NODISCARD span<const fixed_width_column> columns() const noexcept
+        {
+            return {m_columns.data(), m_columns.size()};
+        }
+
+        /// The end of the furthest column: a full record is this long
+        SCN_NODISCARD size_t record_width() const noexcept
+        {
+            return m_record_width;
+        }
+
+    private:
+        void _init()
+        {
+            m_record_width = 0;
+            for (const auto& c : m_columns) {
+                m_record_width = (std::max)(m_record_width, c.offset + c.width);
+            }
+        }
+
+        std::vector<fixed_width_column> m_columns;
+        size_t m_record_width{0};
+    };
+
+    /**
+     * Used to customize `basic_fixed_width_reader`.
+     */
+    struct fixed_width_options {
+        /**
+         * Length of every record, in code units, with no separator between
+         * records.
+         * If `0`, records are instead separated by <tt>'\\n'</tt>, and can
+         * be of differing lengths.
+         */
+        size_t record_length{0};
+        /**
+         * If `true`, and `record_length == 0`, a <tt>'\\r'</tt> before the
+         * <tt>'\\n'</tt> ending a record is not a part of the record, so
+         * that <tt>"\\r\\n"</tt> line endings can be read.
+         */
+        bool strip_cr{true};
+        /**
+         * If `true`, whitespace (padding) is removed from both ends of every
+         * field.
+         */
+        bool trim{true};
+    };
+
+    /**
+     * Splits a contiguous source range into records, and records into
+     * fields, as described by a `fixed_width_layout`.
+     *
+     * A field is sliced directly from its record, by its offset and width,
+     * without looking at the characters inside it, and is returned as a
+     * view into the source.
+     * A column extending past the end of a short record is truncated to the
+     * end of the record, or empty, if it starts past it.
+     *
+     * \code{.cpp}
+     * auto file = scn::mapped_file{"export.txt"};
+     * auto reader = scn::fixed_width(
+     *     file, scn::fixed_width_layout::from_widths({10, 8}));
+     * int id;
+     * double amount, total = 0;
+     * auto e = reader.for_each_record(
+     *     [&]() { total += amount; }, id, amount);
+     * \endcode
+     *
+     * \see fixed_width
+     */
+    template <typename CharT>
+    class basic_fixed_width_reader {
+    public:
+        using char_type = CharT;
+        using string_view_type = basic_string_view<CharT>;
+        using layout_type = fixed_width_layout;
+        using options_type = fixed_width_options;
+
+        basic_fixed_width_reader(span<const CharT> source,
+                                 layout_type layout,
+                                 options_type o = {})
+            : m_pos(source.data()),
+              m_end(source.data() + source.size()),
+              m_layout(SCN_MOVE(layout)),
+              m_options(o)
+        {
+        }
+
+        /// `true`, if every record has been read
+        SCN_NODISCARD bool at_end() const noexcept
+        {
+            return m_pos == m_end;
+        }
+
+        /// The part of the source that hasn't been read yet
+        SCN_NODISCARD span<const CharT> remaining() const noexcept
+        {
+            return {m_pos, m_end};
+        }
+
+        /**
+         * Reads the next record.
+         *
+         * \return The record, without the newline ending it, or
+         * `error::end_of_range` if `at_end()`.
+         */
+        expected<string_view_type> next_record()
+        {
+            if (at_end()) {
+                return error(error::end_of_range, "EOF");
+            }
+            const auto avail = static_cast<size_t>(m_end - m_pos);
+            if (m_options.record_length != 0) {
+                const auto len = (std::min)(m_options.record_length, avail);
+                auto rec = string_view_type{m_pos, len};
+                m_pos += len;
+                return {rec};
+            }
+
+            auto nl = std::char_traits<CharT>::find(
+                m_pos, avail, detail::ascii_widen<CharT>('\n'));
+            auto record_end = nl ? nl : m_end;
+            auto rec = string_view_type{
+                m_pos, static_cast<size_t>(record_end - m_pos)};
+            m_pos = nl ? nl + 1 : m_end;
+            if (m_options.strip_cr && rec.size() != 0 &&
+                rec[rec.size() - 1] == detail::ascii_widen<CharT>('\r')) {
+                rec.remove_suffix(1);
+            }
+            return {rec};
+        }
+
+        /**
+         * Returns the field in column `i` of `record`, trimmed if
+         * `options().trim`.
+         */
+        SCN_NODISCARD string_view_type field(string_view_type record,
+                                             size_t i) const
+        {
+            const auto& col = m_layout[i];
+            if (col.offset >= record.size()) {
+                return {};
+            }
+            auto f = record.substr(
+                col.offset, (std::min)(col.width, record.size() - col.offset));
+            if (m_options.trim) {
+                while (f.size() != 0 && detail::is_space(f[0])) {
+                    f.remove_prefix(1);
+                }
+                while (f.size() != 0 && detail::is_space(f[f.size() - 1])) {
+                    f.remove_suffix(1);
+                }
+            }
+            return f;
+        }
+
+        /**
+         * Reads a record, and scans the fields in its first
+         * `sizeof...(Args)` columns into the respective `a`.
+         *
+         * A field is scanned into a `std::basic_string<CharT>` as-is, and
+         * into a `basic_string_view<CharT>` without copying.
+         * Otherwise, the field is scanned with the scanner for its type,
+         * directly, with the default options: the field must contain only
+         * the value scanned, and whitespace.
+         *
+         * The record is consumed, even if a field couldn't be scanned.
+         *
+         * \return `error::invalid_operation` if there are more arguments than
+         * columns in the layout, or `error::invalid_scanned_value` if a
+         * field couldn't be scanned, or if a field not scanned into a string
+         * is empty or blank.
+         * Other errors from `next_record()` are passed through.
+         */
+        template <typename... Args>
+        error read_record(Args&... a)
+        {
+            if (sizeof...(Args) > m_layout.size()) {
+                return {error::invalid_operation,
+                        "More arguments than columns in fixed_width_layout"};
+            }
+            auto rec = next_record();
+            if (!rec) {
+                return rec.error();
+            }
+            return _read_fields(rec.value(), 0, a...);
+        }
+
+        /**
+         * Reads every remaining record into `a` with `read_record()`,
+         * calling `f()` after each one.
+         *
+         * \return The first error from `read_record()`, or a value
+         * signifying success, if every record was read.
+         * On error, reading stops after the record that failed.
+         */
+        template <typename F, typename... Args>
+        error for_each_record(F f, Args&... a)
+        {
+            while (!at_end()) {
+                auto e = read_record(a...);
+                if (!e) {
+                    return e;
+                }
+                f();
+            }
+            return {};
+        }
+
+        SCN_NODISCARD const layout_type& layout() const noexcept
+        {
+            return m_layout;
+        }
+        SCN_NODISCARD const options_type& options() const noexcept
+        {
+            return m_options;
+        }
+
+    private:
+        error _read_fields(string_view_type, size_t)
+        {
+            return {};
+        }
+        template <typename T, typename... Args>
+        error _read_fields(string_view_type rec,
+                           size_t i,
+                           T& val,
+                           Args&... a)
+        {
+            auto e = detail::scan_field(field(rec, i), val);
+            if (!e) {
+                return e;
+            }
+            return _read_fields(rec, i + 1, a...);
+        }
+
+        const CharT* m_pos;
+        const CharT* m_end;
+        layout_type m_layout;
+        options_type m_options;
+    };
+
+    using fixed_width_reader = basic_fixed_width_reader<char>;
+    using wfixed_width_reader = basic_fixed_width_reader<wchar_t>;
+
+    /**
+     * Returns a `basic_fixed_width_reader` over `r`, which must be a
+     * contiguous range, e.g. a `string_view` or a `mapped_file`.
+     * The returned reader points into `r`.
+     */
+    template <typename Range,
+              typename CharT = ranges::range_value_t<const Range>,
+              typename std::enable_if<
+                  SCN_CHECK_CONCEPT(ranges::contiguous_range<const Range>) &&
+                  SCN_CHECK_CONCEPT(ranges::sized_range<const Range>)>::type* =
+                  nullptr>
+    basic_fixed_width_reader<CharT> fixed_width(const Range& r,
+                                                fixed_width_layout layout,
+                                                fixed_width_options o = {})
+    {
+        return {detail::records_source(r), SCN_MOVE(layout), o};
+    }
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#endif  // SCN_SCAN_FIXED_WIDTH_H
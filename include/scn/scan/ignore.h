@@ -24,90 +24,144 @@ namespace scn {
     SCN_BEGIN_NAMESPACE
 
     namespace detail {
-        template <typename CharT>
-        struct ignore_iterator {
-            using value_type = CharT;
-            using pointer = value_type*;
-            using reference = value_type&;
-            using difference_type = std::ptrdiff_t;
-            using iterator_category = std::output_iterator_tag;
-
-            constexpr ignore_iterator() = default;
-
-            SCN_CONSTEXPR14 ignore_iterator& operator=(CharT) noexcept
-            {
-                return *this;
-            }
-            constexpr const ignore_iterator& operator=(CharT) const noexcept
-            {
-                return *this;
-            }
-
-            SCN_CONSTEXPR14 ignore_iterator& operator*() noexcept
-            {
-                return *this;
+        // Skipping until a single code unit can be done a buffer at a time,
+        // with `char_traits::find` (`memchr`/`wmemchr`), instead of going
+        // through read_until_space a character at a time.
+        // `done` is set to `false`, if the general path needs to continue
+        // from where this left off.
+
+        template <typename WrappedRange, typename CharT>
+        error ignore_until_discard(WrappedRange& r,
+                                   CharT until,
+                                   std::ptrdiff_t n,
+                                   bool& done,
+                                   std::true_type)
+        {
+            done = true;
+            auto e = r.discard_until(until, n);
+            if (e.code() != error::end_of_range) {
+                return e;
             }
-            constexpr const ignore_iterator& operator*() const noexcept
-            {
-                return *this;
+            // Reaching the end isn't an error here:
+            // skip whatever was kept in the buffer
+            while (r.get_buffer_and_advance().size() != 0) {
             }
+            return {};
+        }
+        template <typename WrappedRange, typename CharT>
+        error ignore_until_discard(WrappedRange&,
+                                   CharT,
+                                   std::ptrdiff_t,
+                                   bool& done,
+                                   std::false_type)
+        {
+            done = false;
+            return {};
+        }
 
-            SCN_CONSTEXPR14 ignore_iterator& operator++() noexcept
-            {
-                return *this;
-            }
-            constexpr const ignore_iterator& operator++() const noexcept
-            {
-                return *this;
-            }
-        };
-
-        template <typename CharT>
-        struct ignore_iterator_n {
-            using value_type = CharT;
-            using pointer = value_type*;
-            using reference = value_type&;
-            using difference_type = std::ptrdiff_t;
-            using iterator_category = std::output_iterator_tag;
-
-            ignore_iterator_n() = default;
-            ignore_iterator_n(difference_type n) : i(n) {}
-
-            constexpr const ignore_iterator_n& operator=(CharT) const noexcept
-            {
-                return *this;
+        template <typename WrappedRange, typename CharT>
+        error ignore_until_buffer(WrappedRange& r,
+                                  CharT until,
+                                  std::ptrdiff_t& n,
+                                  bool& done,
+                                  std::true_type)
+        {
+            // Comparing r.begin() with r.end() may read more into the
+            // buffer (files), so only stop when the buffer runs out
+            while (n > 0) {
+                auto s = r.get_buffer_and_advance(static_cast<size_t>(n));
+                if (s.size() == 0) {
+                    break;
+                }
+                auto p = std::char_traits<CharT>::find(s.data(), s.size(),
+                                                       until);
+                if (p) {
+                    done = true;
+                    return putback_n(r, s.end() - p);
+                }
+                n -= s.ssize();
             }
-
-            constexpr const ignore_iterator_n& operator*() const noexcept
-            {
-                return *this;
+            if (n == 0) {
+                done = true;
+                return {};
             }
+            return ignore_until_discard(
+                r, until, n, done,
+                std::integral_constant<
+                    bool, WrappedRange::provides_discard_until>{});
+        }
+        template <typename WrappedRange, typename CharT>
+        error ignore_until_buffer(WrappedRange&,
+                                  CharT,
+                                  std::ptrdiff_t&,
+                                  bool& done,
+                                  std::false_type)
+        {
+            done = false;
+            return {};
+        }
 
-            SCN_CONSTEXPR14 ignore_iterator_n& operator++() noexcept
-            {
-                ++i;
-                return *this;
-            }
+        template <typename WrappedRange, typename CharT>
+        error ignore_until_single(WrappedRange& r,
+                                  CharT until,
+                                  std::ptrdiff_t& n,
+                                  bool& done,
+                                  std::true_type)
+        {
+            const auto size = ranges::distance(r.begin(), r.end());
+            const auto len = static_cast<size_t>(n < size ? n : size);
+            auto p = std::char_traits<CharT>::find(r.data(), len, until);
+            r.advance(p ? p - r.data() : static_cast<std::ptrdiff_t>(len));
+            done = true;
+            return {};
+        }
+        template <typename WrappedRange, typename CharT>
+        error ignore_until_single(WrappedRange& r,
+                                  CharT until,
+                                  std::ptrdiff_t& n,
+                                  bool& done,
+                                  std::false_type)
+        {
+            return ignore_until_buffer(
+                r, until, n, done,
+                std::integral_constant<
+                    bool, WrappedRange::provides_buffer_access>{});
+        }
 
-            constexpr bool operator==(const ignore_iterator_n& o) const noexcept
-            {
-                return i == o.i;
-            }
-            constexpr bool operator!=(const ignore_iterator_n& o) const noexcept
-            {
-                return !(*this == o);
+        template <typename WrappedRange, typename CharT>
+        error ignore_until_fast(WrappedRange& r,
+                                const until_pred<CharT>& pred,
+                                std::ptrdiff_t& n,
+                                bool& done)
+        {
+            done = false;
+            if (pred.is_multibyte()) {
+                return {};
             }
-
-            difference_type i{0};
-        };
+            return ignore_until_single(
+                r, pred.until[0], n, done,
+                std::integral_constant<bool, WrappedRange::is_contiguous>{});
+        }
 
         template <typename WrappedRange,
                   typename Until,
                   typename CharT = typename WrappedRange::char_type>
         error ignore_until_impl(WrappedRange& r, Until until)
         {
+            if (r.begin() == r.end()) {
+                return {error::end_of_range, "EOF"};
+            }
+
+            auto pred = until_pred<CharT>{until};
+            auto n = std::numeric_limits<std::ptrdiff_t>::max();
+            bool done = false;
+            auto e = ignore_until_fast(r, pred, n, done);
+            if (!e || done || r.begin() == r.end()) {
+                return e;
+            }
+
             ignore_iterator<CharT> it{};
-            return read_until_space(r, it, until_pred<CharT>{until}, false);
+            return read_until_space(r, it, pred, false);
         }
 
         template <typename WrappedRange,
@@ -117,9 +171,20 @@ namespace scn {
                                   ranges::range_difference_t<WrappedRange> n,
                                   Until until)
         {
-            ignore_iterator_n<CharT> begin{}, end{n};
-            return read_until_space_ranged(r, begin, end,
-                                           until_pred<CharT>{until}, false);
+            if (r.begin() == r.end()) {
+                return {error::end_of_range, "EOF"};
+            }
+
+            auto pred = until_pred<CharT>{until};
+            auto left = static_cast<std::ptrdiff_t>(n);
+            bool done = false;
+            auto e = ignore_until_fast(r, pred, left, done);
+            if (!e || done || r.begin() == r.end()) {
+                return e;
+            }
+
+            ignore_iterator_n<CharT> begin{}, end{left};
+            return read_until_space_ranged(r, begin, end, pred, false);
         }
     }  // namespace detail
 
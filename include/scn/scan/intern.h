@@ -0,0 +1,514 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_SCAN_INTERN_H
+#define SCN_SCAN_INTERN_H
+
+#include "../reader/string.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    /**
+     * A fixed set of tokens, each mapped to a value of type `T` (e.g. an
+     * integer id, or an enumeration), that can be looked up without
+     * allocating.
+     *
+     * The table is a perfect hash, built when it's constructed: a lookup
+     * hashes the token once, and compares it against a single candidate.
+     * The tokens are copied into the table.
+     *
+     * \code{.cpp}
+     * enum class level { debug, info, warn, error };
+     * auto levels = scn::symbol_table<level>{{"DEBUG", level::debug},
+     *                                        {"INFO", level::info},
+     *                                        {"WARN", level::warn},
+     *                                        {"ERROR", level::error}};
+     * const level* l = levels.find("WARN");
+     * // *l == level::warn
+     * \endcode
+     *
+     * \see basic_interned
+     */
+    template <typename CharT, typename T = int>
+    class basic_symbol_table {
+    public:
+        using char_type = CharT;
+        using value_type = T;
+        using string_view_type = basic_string_view<CharT>;
+
+        /// A token, and the value it maps to
+        struct symbol {
+            string_view_type token;
+            T value;
+        };
+
+        /**
+         * If a token is given more than once, the first value given for it
+         * is used.
+         */
+        basic_symbol_table(std::initializer_list<symbol> symbols)
+        {
+            _build(symbols.begin(), symbols.end());
+        }
+        template <typename InputIt>
+        basic_symbol_table(InputIt first, InputIt last)
+        {
+            _build(first, last);
+        }
+
+        /// Number of tokens in the table
+        SCN_NODISCARD size_t size() const noexcept
+        {
+            return m_entries.size();
+        }
+
+        /**
+         * Returns a pointer to the value `token` maps to, or `nullptr`, if
+         * `token` isn't in the table.
+         */
+        SCN_NODISCARD const T* find(string_view_type token) const noexcept
+        {
+            if (m_entries.empty()) {
+                return nullptr;
+            }
+            const auto h = _hash(token);
+            const auto d = m_displacements[_bucket(h)];
+            const auto i = m_slots[_slot(h, d)];
+            if (i == 0) {
+                return nullptr;
+            }
+            const auto& e = m_entries[i - 1];
+            if (e.size != token.size() ||
+                std::char_traits<CharT>::compare(m_tokens.data() + e.offset,
+                                                 token.data(),
+                                                 token.size()) != 0) {
+                return nullptr;
+            }
+            return &e.value;
+        }
+
+    private:
+        struct entry {
+            size_t offset;
+            size_t size;
+            uint64_t hash;
+            T value;
+        };
+
+        uint64_t _hash(string_view_type s) const noexcept
+        {
+            using uchar_type = typename std::make_unsigned<CharT>::type;
+            // FNV-1a, with the offset basis varied by the seed
+            uint64_t h = 0xcbf29ce484222325ULL ^
+                         static_cast<uint64_t>(m_seed) * 0x9e3779b97f4a7c15ULL;
+            for (auto ch : s) {
+                h ^= static_cast<uint64_t>(static_cast<uchar_type>(ch));
+                h *= 0x100000001b3ULL;
+            }
+            return h;
+        }
+        size_t _bucket(uint64_t h) const noexcept
+        {
+            return static_cast<size_t>(h >> 32) & (m_displacements.size() - 1);
+        }
+        size_t _slot(uint64_t h, uint32_t d) const noexcept
+        {
+            h ^= static_cast<uint64_t>(d) * 0x9e3779b97f4a7c15ULL;
+            h ^= h >> 32;
+            h *= 0xd6e8feb86659fd93ULL;
+            h ^= h >> 32;
+            return static_cast<size_t>(h) & (m_slots.size() - 1);
+        }
+
+        static size_t _ceil_pow2(size_t n) noexcept
+        {
+            size_t p = 1;
+            while (p < n) {
+                p *= 2;
+            }
+            return p;
+        }
+
+        string_view_type _token(const entry& e) const noexcept
+        {
+            return {m_tokens.data() + e.offset, e.size};
+        }
+
+        template <typename InputIt>
+        void _build(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first) {
+                const symbol& s = *first;
+                m_entries.push_back({m_tokens.size(), s.token.size(), 0,
+                                     s.value});
+                m_tokens.append(s.token.data(), s.token.size());
+            }
+            if (m_entries.empty()) {
+                return;
+            }
+            while (!_hash_entries()) {
+                ++m_seed;
+            }
+
+            // Hash and displace: the tokens are split into buckets, and
+            // every bucket, biggest first, gets a displacement that puts
+            // all of its tokens into free slots
+            m_displacements.assign(_ceil_pow2((m_entries.size() + 1) / 2),
+                                   0);
+            const auto min_slot_count = _ceil_pow2(m_entries.size() * 2);
+            auto slot_count = min_slot_count;
+            while (!_place(slot_count)) {
+                slot_count *= 2;
+                if (slot_count > min_slot_count * 16) {
+                    // Unlucky hashes: try different ones,
+                    // instead of growing the table any further
+                    ++m_seed;
+                    while (!_hash_entries()) {
+                        ++m_seed;
+                    }
+                    slot_count = min_slot_count;
+                }
+            }
+        }
+
+        // Hashes every entry with the current seed, and removes duplicate
+        // tokens, keeping the first one.
+        // Returns `false`, if two different tokens have the same hash:
+        // they could never be placed into different slots.
+        bool _hash_entries()
+        {
+            for (auto& e : m_entries) {
+                e.hash = _hash(_token(e));
+            }
+
+            // Sorting by hash puts duplicates (and collisions) next to
+            // each other, with the first one given first
+            std::vector<uint32_t> order(m_entries.size());
+            for (size_t i = 0; i < order.size(); ++i) {
+                order[i] = static_cast<uint32_t>(i);
+            }
+            std::stable_sort(order.begin(), order.end(),
+                             [&](uint32_t a, uint32_t b) {
+                                 return m_entries[a].hash <
+                                        m_entries[b].hash;
+                             });
+
+            std::vector<bool> dup(m_entries.size(), false);
+            size_t first_of_hash = 0;
+            for (size_t i = 1; i < order.size(); ++i) {
+                const auto& prev = m_entries[order[first_of_hash]];
+                const auto& e = m_entries[order[i]];
+                if (e.hash != prev.hash) {
+                    first_of_hash = i;
+                    continue;
+                }
+                const auto a = _token(prev), b = _token(e);
+                if (a.size() != b.size() ||
+                    std::char_traits<CharT>::compare(a.data(), b.data(),
+                                                     a.size()) != 0) {
+                    return false;
+                }
+                dup[order[i]] = true;
+            }
+
+            size_t n = 0;
+            for (size_t i = 0; i < m_entries.size(); ++i) {
+                if (!dup[i]) {
+                    m_entries[n++] = m_entries[i];
+                }
+            }
+            m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(n),
+                            m_entries.end());
+            return true;
+        }
+
+        bool _place(size_t slot_count)
+        {
+            m_slots.assign(slot_count, 0);
+
+            std::vector<std::vector<uint32_t>> buckets(
+                m_displacements.size());
+            for (size_t i = 0; i < m_entries.size(); ++i) {
+                buckets[_bucket(m_entries[i].hash)].push_back(
+                    static_cast<uint32_t>(i));
+            }
+            std::vector<uint32_t> order(buckets.size());
+            for (size_t b = 0; b < order.size(); ++b) {
+                order[b] = static_cast<uint32_t>(b);
+            }
+            std::stable_sort(order.begin(), order.end(),
+                             [&](uint32_t a, uint32_t b) {
+                                 return buckets[a].size() > buckets[b].size();
+                             });
+
+            std::vector<size_t> taken;
+            for (auto b : order) {
+                const auto& bucket = buckets[b];
+                if (bucket.empty()) {
+                    break;
+                }
+                bool placed = false;
+                for (uint32_t d = 0; d < 1024 && !placed; ++d) {
+                    taken.clear();
+                    placed = true;
+                    for (auto i : bucket) {
+                        const auto s = _slot(m_entries[i].hash, d);
+                        if (m_slots[s] != 0 ||
+                            std::find(taken.begin(), taken.end(), s) !=
+                                taken.end()) {
+                            placed = false;
+                            break;
+                        }
+                        taken.push_back(s);
+                    }
+                    if (placed) {
+                        m_displacements[b] = d;
+                        for (size_t j = 0; j < bucket.size(); ++j) {
+                            m_slots[taken[j]] = bucket[j] + 1;
+                        }
+                    }
+                }
+                if (!placed) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::basic_string<CharT> m_tokens{};
+        std::vector<entry> m_entries{};
+        std::vector<uint32_t> m_displacements{};
+        // index into m_entries + 1, 0 if empty
+        std::vector<uint32_t> m_slots{};
+        uint32_t m_seed{0};
+    };
+
+    template <typename T = int>
+    using symbol_table = basic_symbol_table<char, T>;
+    template <typename T = int>
+    using wsymbol_table = basic_symbol_table<wchar_t, T>;
+
+    /**
+     * Scanned like a `string_view`, except that the token read is looked up
+     * in a `basic_symbol_table`, and the value it maps to is stored.
+     * The token isn't copied anywhere: with a contiguous source range,
+     * no memory is allocated.
+     *
+     * The format string options of strings can be used, e.g.
+     * <tt>{:[a-zA-Z_]}</tt> to end the token at the first character not in
+     * the set.
+     *
+     * If the token isn't in the table, and `allow_unknown` is `false`, an
+     * error with the code `error::invalid_scanned_value` is returned.
+     * Otherwise, `unknown` is set to point to the token in the source
+     * range, and `value` is left untouched.
+     * With a non-contiguous source range, `allow_unknown` can only be
+     * `true`, if the range provides pinned segments.
+     *
+     * \code{.cpp}
+     * auto methods = scn::symbol_table<>{{"GET", 0}, {"PUT", 1}};
+     * auto method = scn::interned<>{methods};
+     * scn::string_view path;
+     * auto ret = scn::scan("GET /index.html", "{} {}", method, path);
+     * // method.value == 0
+     * \endcode
+     */
+    template <typename CharT, typename T = int>
+    struct basic_interned {
+        using table_type = basic_symbol_table<CharT, T>;
+
+        explicit basic_interned(const table_type& t, bool allow = false)
+            : table(&t), allow_unknown(allow)
+        {
+        }
+
+        /// `true`, if the last token scanned was found in `table`
+        SCN_NODISCARD bool known() const noexcept
+        {
+            return unknown.size() == 0;
+        }
+
+        const table_type* table;
+        /// The value the last token scanned maps to
+        T value{};
+        /**
+         * The last token scanned, if it wasn't found in `table`, and
+         * `allow_unknown` is `true`, empty otherwise
+         */
+        basic_string_view<CharT> unknown{};
+        bool allow_unknown;
+    };
+
+    template <typename T = int>
+    using interned = basic_interned<char, T>;
+    template <typename T = int>
+    using winterned = basic_interned<wchar_t, T>;
+
+    template <typename CharT, typename T>
+    struct scanner<basic_interned<CharT, T>>
+        : public detail::string_view_scanner {
+        template <typename Context>
+        error scan(basic_interned<CharT, T>& val, Context& ctx)
+        {
+            static_assert(
+                std::is_same<typename Context::char_type, CharT>::value,
+                "The character type of the symbol table must match the "
+                "source range");
+
+            return _scan(
+                val, ctx,
+                std::integral_constant<bool,
+                                       Context::range_type::is_contiguous>{});
+        }
+
+    private:
+        template <typename Context>
+        error _scan(basic_interned<CharT, T>& val,
+                    Context& ctx,
+                    std::true_type)
+        {
+            auto token = basic_string_view<CharT>{};
+            auto e = string_view_scanner::scan(token, ctx);
+            if (!e) {
+                return e;
+            }
+            return _lookup(val, token, ctx, ctx.range().begin());
+        }
+
+        // Read into a local buffer, to not pin every token
+        template <typename Context>
+        error _scan(basic_interned<CharT, T>& val,
+                    Context& ctx,
+                    std::false_type)
+        {
+            detail::small_vector<CharT, 64> buf{};
+            auto start = ctx.range().begin();
+            error e{};
+            if (set_parser.enabled()) {
+                bool loc = (common_options & localized) != 0;
+                bool mb =
+                    (loc || set_parser.get_option(
+                                detail::set_parser_type::flag::use_ranges)) &&
+                    detail::is_multichar_type(CharT{});
+                e = _read_token(
+                    buf, start, ctx,
+                    string_scanner::pred<Context>{ctx, set_parser, loc, mb});
+            }
+            else {
+                e = skip_range_whitespace(ctx, false);
+                if (!e) {
+                    return e;
+                }
+                e = _read_token(buf, start, ctx,
+                                detail::make_is_space_predicate(
+                                    ctx.locale(),
+                                    (common_options & localized) != 0,
+                                    field_width));
+            }
+            if (!e) {
+                return e;
+            }
+            return _lookup(val, {buf.data(), buf.size()}, ctx, start);
+        }
+        template <typename Context, typename Buffer, typename Pred>
+        static error _read_token(Buffer& buf,
+                                 typename Context::range_type::iterator& start,
+                                 Context& ctx,
+                                 Pred&& predicate)
+        {
+            start = ctx.range().begin();
+            auto it = std::back_inserter(buf);
+            auto e =
+                read_until_space(ctx.range(), it, SCN_FWD(predicate), false);
+            if (!e) {
+                return e;
+            }
+            if (buf.empty()) {
+                return {error::invalid_scanned_value, "Empty string parsed"};
+            }
+            return {};
+        }
+
+        // `start` is where `token` was read from
+        template <typename Context>
+        static error _lookup(basic_interned<CharT, T>& val,
+                             basic_string_view<CharT> token,
+                             Context& ctx,
+                             typename Context::range_type::iterator start)
+        {
+            if (auto v = val.table->find(token)) {
+                val.value = *v;
+                val.unknown = {};
+                return {};
+            }
+            if (!val.allow_unknown) {
+                return {error::invalid_scanned_value, "Unknown token"};
+            }
+            using range_type = typename Context::range_type;
+            return _set_unknown(
+                val.unknown, token, ctx, start,
+                std::integral_constant<
+                    bool, range_type::is_contiguous ||
+                              !range_type::provides_pinned_segments ||
+                              !range_type::provides_buffer_access>{});
+        }
+
+        // `token` already points into the source range, or
+        // the source range can't keep it alive
+        template <typename Context>
+        static error _set_unknown(basic_string_view<CharT>& unknown,
+                                  basic_string_view<CharT> token,
+                                  Context&,
+                                  typename Context::range_type::iterator,
+                                  std::true_type)
+        {
+            if (!Context::range_type::is_contiguous) {
+                return {error::invalid_operation,
+                        "Cannot return an unknown token as a string_view "
+                        "from a non-contiguous range"};
+            }
+            unknown = token;
+            return {};
+        }
+        template <typename Context,
+                  typename std::enable_if<Context::range_type::
+                                              provides_pinned_segments>::
+                      type* = nullptr>
+        static error _set_unknown(
+            basic_string_view<CharT>& unknown,
+            basic_string_view<CharT> token,
+            Context& ctx,
+            typename Context::range_type::iterator start,
+            std::false_type)
+        {
+            unknown = detail::pin_read(
+                ctx.range(), start, static_cast<std::ptrdiff_t>(token.size()));
+            return {};
+        }
+    };
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#endif  // SCN_SCAN_INTERN_H
@@ -27,6 +27,14 @@ namespace scn {
     SCN_BEGIN_NAMESPACE
 
     namespace detail {
+        /**
+         * `std::basic_streambuf` reading from a range.
+         *
+         * If the range provides buffer access, its buffer is used as the get
+         * area, and the range is advanced by the amount the stream consumed
+         * when the buffer runs out, or this object is destroyed.
+         * Otherwise, characters are read one at a time.
+         */
         template <typename WrappedRange>
         class range_streambuf
             : public std::basic_streambuf<typename WrappedRange::char_type> {
@@ -42,14 +50,33 @@ namespace scn {
             {
             }
 
+            range_streambuf(const range_streambuf&) = delete;
+            range_streambuf& operator=(const range_streambuf&) = delete;
+
+            ~range_streambuf() override
+            {
+                _release_get_area();
+            }
+
         private:
             int_type underflow() override
             {
+                if (this->gptr() != this->egptr()) {
+                    return traits_type::to_int_type(*this->gptr());
+                }
+                _release_get_area();
+
                 // already read
                 if (!traits_type::eq_int_type(m_ch, traits_type::eof())) {
                     return m_ch;
                 }
 
+                if (_fill_get_area(
+                        std::integral_constant<
+                            bool, range_type::provides_buffer_access>{})) {
+                    return traits_type::to_int_type(*this->gptr());
+                }
+
                 auto ret = read_code_unit(*m_range);
                 if (!ret) {
                     // error
@@ -62,7 +89,13 @@ namespace scn {
             int_type uflow() override
             {
                 auto ret = underflow();
-                if (ret != traits_type::eof()) {
+                if (traits_type::eq_int_type(ret, traits_type::eof())) {
+                    return ret;
+                }
+                if (this->gptr() != this->egptr()) {
+                    this->gbump(1);
+                }
+                else {
                     m_ch = traits_type::eof();
                 }
                 return ret;
@@ -72,13 +105,59 @@ namespace scn {
                 return traits_type::eq_int_type(m_ch, traits_type::eof()) ? 0
                                                                           : 1;
             }
-            int_type pbackfail(int_type) override
+            int_type pbackfail(int_type c) override
             {
-                auto e = putback_n(*m_range, 1);
+                if (this->gptr() != this->eback()) {
+                    // The get area can't be written into:
+                    // only the position is rolled back, so `c` has to be
+                    // the character already there
+                    if (!traits_type::eq_int_type(c, traits_type::eof()) &&
+                        !traits_type::eq_int_type(
+                            c, traits_type::to_int_type(this->gptr()[-1]))) {
+                        return traits_type::eof();
+                    }
+                    this->gbump(-1);
+                    return traits_type::not_eof(c);
+                }
+                _release_get_area();
+
+                // the range is already past a character read ahead
+                const auto n =
+                    traits_type::eq_int_type(m_ch, traits_type::eof()) ? 1
+                                                                       : 2;
+                m_ch = traits_type::eof();
+                auto e = putback_n(*m_range, n);
                 if (!e) {
                     return traits_type::eof();
                 }
-                return traits_type::to_int_type(0);
+                return traits_type::not_eof(c);
+            }
+
+            bool _fill_get_area(std::true_type)
+            {
+                auto buf = get_buffer(m_range->range_underlying(),
+                                      m_range->begin());
+                if (buf.size() == 0) {
+                    return false;
+                }
+                // The stream only ever reads from the get area
+                auto p = const_cast<char_type*>(buf.data());
+                this->setg(p, p, p + buf.size());
+                return true;
+            }
+            bool _fill_get_area(std::false_type)
+            {
+                return false;
+            }
+
+            // Advance the range past what has been consumed from the get area
+            void _release_get_area()
+            {
+                if (this->eback() == nullptr) {
+                    return;
+                }
+                m_range->advance(this->gptr() - this->eback());
+                this->setg(nullptr, nullptr, nullptr);
             }
 
             range_type* m_range;
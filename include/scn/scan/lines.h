@@ -0,0 +1,319 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_SCAN_LINES_H
+#define SCN_SCAN_LINES_H
+
+#include "common.h"
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    /**
+     * View over the lines of a contiguous range, yielding a
+     * `basic_string_view<CharT>` pointing into the range for every line.
+     * The line terminator <tt>'\\n'</tt> is not included.
+     *
+     * \see lines
+     */
+    template <typename CharT>
+    class basic_lines_view {
+    public:
+        using char_type = CharT;
+        using string_view_type = basic_string_view<CharT>;
+
+        class iterator {
+        public:
+            using value_type = string_view_type;
+            using reference = value_type;
+            using pointer = void;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+            iterator() = default;
+
+            reference operator*() const noexcept
+            {
+                auto end = m_line_end;
+                if (m_strip_cr && end != m_begin &&
+                    *(end - 1) == detail::ascii_widen<CharT>('\r')) {
+                    --end;
+                }
+                return {m_begin, static_cast<size_t>(end - m_begin)};
+            }
+
+            iterator& operator++() noexcept
+            {
+                m_begin = m_line_end == m_end ? m_end : m_line_end + 1;
+                m_line_end = _find_line_end();
+                return *this;
+            }
+            iterator operator++(int) noexcept
+            {
+                auto tmp = *this;
+                operator++();
+                return tmp;
+            }
+
+            bool operator==(const iterator& o) const noexcept
+            {
+                return m_begin == o.m_begin;
+            }
+            bool operator!=(const iterator& o) const noexcept
+            {
+                return !operator==(o);
+            }
+
+        private:
+            friend class basic_lines_view;
+
+            iterator(const CharT* b, const CharT* e, bool strip_cr) noexcept
+                : m_begin(b), m_end(e), m_strip_cr(strip_cr)
+            {
+                m_line_end = _find_line_end();
+            }
+
+            const CharT* _find_line_end() const noexcept
+            {
+                if (m_begin == m_end) {
+                    return m_end;
+                }
+                auto p = std::char_traits<CharT>::find(
+                    m_begin, static_cast<size_t>(m_end - m_begin),
+                    detail::ascii_widen<CharT>('\n'));
+                return p ? p : m_end;
+            }
+
+            const CharT* m_begin{nullptr};
+            const CharT* m_line_end{nullptr};
+            const CharT* m_end{nullptr};
+            bool m_strip_cr{false};
+        };
+        using sentinel = iterator;
+
+        constexpr basic_lines_view() noexcept = default;
+        /**
+         * \param source Range to split into lines
+         * \param strip_cr If `true`, a <tt>'\\r'</tt> before <tt>'\\n'</tt>
+         * (or before the end of `source`) is not included in the line
+         */
+        constexpr basic_lines_view(span<const CharT> source,
+                                   bool strip_cr = false) noexcept
+            : m_source(source), m_strip_cr(strip_cr)
+        {
+        }
+
+        iterator begin() const noexcept
+        {
+            return {m_source.data(), m_source.data() + m_source.size(),
+                    m_strip_cr};
+        }
+        sentinel end() const noexcept
+        {
+            auto e = m_source.data() + m_source.size();
+            return {e, e, m_strip_cr};
+        }
+
+    private:
+        span<const CharT> m_source{};
+        bool m_strip_cr{false};
+    };
+
+    /**
+     * Input range over the lines of a `basic_file<CharT>`.
+     * Every line is read into a buffer owned by this object, which is reused
+     * for every line: the `string_view` yielded by the iterator is only valid
+     * until it's incremented.
+     * The line terminator <tt>'\\n'</tt> is not included.
+     *
+     * Reading stops on EOF, or on the first error, which can be inspected
+     * with `get_error()`.
+     *
+     * \see lines
+     */
+    template <typename CharT>
+    class basic_file_lines {
+    public:
+        using char_type = CharT;
+        using string_view_type = basic_string_view<CharT>;
+        using file_type = basic_file<CharT>;
+
+        class iterator {
+        public:
+            using value_type = string_view_type;
+            using reference = value_type;
+            using pointer = void;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::input_iterator_tag;
+
+            iterator() = default;
+
+            reference operator*() const noexcept
+            {
+                SCN_EXPECT(m_lines);
+                return {m_lines->m_line.data(), m_lines->m_line.size()};
+            }
+
+            iterator& operator++()
+            {
+                SCN_EXPECT(m_lines);
+                if (!m_lines->_read_next()) {
+                    m_lines = nullptr;
+                }
+                return *this;
+            }
+            void operator++(int)
+            {
+                operator++();
+            }
+
+            bool operator==(const iterator& o) const noexcept
+            {
+                return m_lines == o.m_lines;
+            }
+            bool operator!=(const iterator& o) const noexcept
+            {
+                return !operator==(o);
+            }
+
+        private:
+            friend class basic_file_lines;
+
+            iterator(basic_file_lines* l) noexcept : m_lines(l) {}
+
+            basic_file_lines* m_lines{nullptr};
+        };
+        using sentinel = iterator;
+
+        /**
+         * \param f File to read from
+         * \param strip_cr If `true`, a <tt>'\\r'</tt> before <tt>'\\n'</tt>
+         * (or before EOF) is not included in the line
+         */
+        basic_file_lines(file_type& f, bool strip_cr = false)
+            : m_file(std::addressof(f)), m_strip_cr(strip_cr)
+        {
+        }
+
+        /**
+         * Reads the first line.
+         * Can only be called once.
+         */
+        iterator begin()
+        {
+            if (!_read_next()) {
+                return {};
+            }
+            return {this};
+        }
+        sentinel end() noexcept
+        {
+            return {};
+        }
+
+        /**
+         * The error that stopped the iteration, or `error::good` if the end
+         * of the file was reached
+         */
+        error get_error() const noexcept
+        {
+            return m_error;
+        }
+
+    private:
+        bool _read_next()
+        {
+            // Searched with char_traits::find, and read a block at a time,
+            // instead of going through read_until_space
+            const auto newline = detail::ascii_widen<CharT>('\n');
+            auto ret = m_file->buffer_until(m_file->begin(), newline);
+            if (!ret) {
+                if (ret.error().code() != error::end_of_range) {
+                    m_error = ret.error();
+                }
+                return false;
+            }
+
+            auto line = ret.value();
+            m_line.assign(line.data(), line.size());
+            m_file->drop_buffered(line.size());
+
+            if (m_line.back() == newline) {
+                m_line.pop_back();
+            }
+            if (m_strip_cr && !m_line.empty() &&
+                m_line.back() == detail::ascii_widen<CharT>('\r')) {
+                m_line.pop_back();
+            }
+            return true;
+        }
+
+        file_type* m_file;
+        std::basic_string<CharT> m_line{};
+        error m_error{};
+        bool m_strip_cr;
+    };
+
+    /**
+     * Returns a range over the lines in `r`, without going through the
+     * machinery of `getline` (range wrapping, result objects) for every line.
+     *
+     * If `r` is a contiguous range, e.g. a `string_view` or a
+     * `mapped_file`, returns a `basic_lines_view`, yielding
+     * `basic_string_view`s pointing into `r`.
+     * If `r` is a `basic_file`, returns a `basic_file_lines`, yielding
+     * `basic_string_view`s pointing into a buffer reused for every line.
+     *
+     * \code{.cpp}
+     * scn::mapped_file f{"log.txt"};
+     * for (auto line : scn::lines(f)) {
+     *     // line is a scn::string_view
+     * }
+     * \endcode
+     *
+     * \param strip_cr If `true`, a <tt>'\\r'</tt> at the end of a line is not
+     * included in it, so that <tt>"\\r\\n"</tt> line endings can be read.
+     */
+    template <typename Range,
+              typename CharT = ranges::range_value_t<const Range>,
+              typename std::enable_if<
+                  SCN_CHECK_CONCEPT(ranges::contiguous_range<const Range>) &&
+                  SCN_CHECK_CONCEPT(ranges::sized_range<const Range>) &&
+                  (std::is_same<CharT, char>::value ||
+                   std::is_same<CharT, wchar_t>::value)>::type* = nullptr>
+    basic_lines_view<CharT> lines(const Range& r, bool strip_cr = false)
+    {
+        return {span<const CharT>{ranges::data(r),
+                                  static_cast<size_t>(ranges::size(r))},
+                strip_cr};
+    }
+    template <typename CharT, size_t N>
+    basic_lines_view<CharT> lines(const CharT (&r)[N], bool strip_cr = false)
+    {
+        static_assert(N != 0, "");
+        return {span<const CharT>{r, N - 1}, strip_cr};
+    }
+    template <typename CharT>
+    basic_file_lines<CharT> lines(basic_file<CharT>& r, bool strip_cr = false)
+    {
+        return {r, strip_cr};
+    }
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#endif
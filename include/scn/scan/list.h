@@ -20,6 +20,8 @@
 
 #include "common.h"
 
+#include <algorithm>
+
 namespace scn {
     SCN_BEGIN_NAMESPACE
 
@@ -183,11 +185,170 @@ namespace scn {
             return ret.value().cp;
         }
 
+        // Grow geometrically, like push_back does, so that reserving for
+        // every list appended to the same container isn't quadratic
+        template <typename Container>
+        auto reserve_list(Container& c, size_t n, priority_tag<2>)
+            -> decltype(c.reserve(n), c.capacity(), void())
+        {
+            const auto needed = c.size() + n;
+            if (needed > c.capacity()) {
+                c.reserve(max(needed, 2 * c.capacity()));
+            }
+        }
+        template <typename Container>
+        auto reserve_list(Container& c, size_t n, priority_tag<1>)
+            -> decltype(c.reserve(n), void())
+        {
+            c.reserve(max(c.size() + n, 2 * c.size()));
+        }
+        template <typename Container>
+        void reserve_list(Container&, size_t, priority_tag<0>)
+        {
+        }
+
+        // Estimate for the number of values in `s`, counting separators up
+        // to `until`.
+        // Only the first `window` code units are looked at. The list may end
+        // anywhere past them, so the count isn't extrapolated to the rest of
+        // `s`: reserve_list grows the container geometrically if it goes on.
+        template <typename CharT>
+        size_t estimate_list_size(span<const CharT> s,
+                                  const scan_list_options<CharT>& options)
+        {
+            constexpr size_t window = 1 << 16;
+            if (s.size() == 0) {
+                return 0;
+            }
+            auto w = s.first(min(s.size(), window));
+            if (options.until) {
+                auto p = std::char_traits<CharT>::find(w.data(), w.size(),
+                                                       options.until.get());
+                if (p) {
+                    w = w.first(static_cast<size_t>(p - w.data()));
+                }
+            }
+            const auto sep = options.separator ? options.separator.get()
+                                               : ascii_widen<CharT>(' ');
+            return static_cast<size_t>(std::count(w.begin(), w.end(), sep)) +
+                   1;
+        }
+
+        // Contiguous range, code unit separators:
+        // the scanner is constructed and parsed only once, and separators
+        // are peeked directly from the range
         template <typename Context, typename Container, typename Separator>
         auto scan_list_impl(Context& ctx,
                             bool localized,
                             Container& c,
-                            scan_list_options<Separator> options) -> error
+                            scan_list_options<Separator> options,
+                            std::true_type) -> error
+        {
+            using value_type = typename Container::value_type;
+            using scanner_type = scanner<value_type>;
+            static_assert(
+                !is_type_disabled<value_type,
+                                  typename Context::char_type>::value,
+                "Scanning of this type is disabled");
+
+            auto& r = ctx.range();
+            {
+                const auto est = estimate_list_size(
+                    span<const Separator>{r.data(),
+                                          static_cast<size_t>(r.size())},
+                    options);
+                const auto left = c.max_size() - c.size();
+                reserve_list(c, est < left ? est : left, priority_tag<2>{});
+            }
+
+            scanner_type parsed_scanner{};
+            {
+                auto pctx = make_parse_context(1, ctx.locale(), localized);
+                auto err = pctx.parse(parsed_scanner);
+                if (!err) {
+                    return err;
+                }
+            }
+
+            value_type value;
+            while (true) {
+                if (c.size() == c.max_size()) {
+                    break;
+                }
+
+                // read value
+                auto s = parsed_scanner;
+                auto err = [&]() -> error {
+                    if (s.skip_preceding_whitespace()) {
+                        auto e = skip_range_whitespace(ctx, false);
+                        if (!e) {
+                            return e;
+                        }
+                    }
+                    auto e = skip_alignment(
+                        ctx, s, false,
+                        scanner_supports_alignment<scanner_type>{});
+                    if (!e) {
+                        return e;
+                    }
+                    e = s.scan(value, ctx);
+                    if (!e) {
+                        return e;
+                    }
+                    return skip_alignment(
+                        ctx, s, true,
+                        scanner_supports_alignment<scanner_type>{});
+                }();
+#if SCN_ENABLE_STATS
+                SCN_STATS_ADD(
+                    chars_read[static_cast<size_t>(
+                        get_type<typename Context::char_type,
+                                 value_type>::value)],
+                    r.distance_from_rollback_point());
+#endif
+                if (!err) {
+                    auto rb = r.reset_to_rollback_point();
+                    if (!rb) {
+                        return rb;
+                    }
+                    if (err == error::end_of_range) {
+                        break;
+                    }
+                    return err;
+                }
+                r.set_rollback_point();
+                c.push_back(SCN_MOVE(value));
+
+                // skip until the next value, or stop at `until`
+                while (true) {
+                    if (r.begin() == r.end()) {
+                        return {};
+                    }
+                    const auto next = *r.begin();
+                    if (options.until && next == options.until.get()) {
+                        return {};
+                    }
+                    if (options.separator && next == options.separator.get()) {
+                        r.advance();
+                        continue;
+                    }
+                    if (ctx.locale().get_static().is_space(next)) {
+                        r.advance();
+                        continue;
+                    }
+                    break;
+                }
+            }
+
+            return {};
+        }
+
+        template <typename Context, typename Container, typename Separator>
+        auto scan_list_impl(Context& ctx,
+                            bool localized,
+                            Container& c,
+                            scan_list_options<Separator> options,
+                            std::false_type) -> error
         {
             using char_type = typename Context::char_type;
             using value_type = typename Container::value_type;
@@ -291,6 +452,20 @@ namespace scn {
 
             return {};
         }
+
+        template <typename Context, typename Container, typename Separator>
+        auto scan_list_impl(Context& ctx,
+                            bool localized,
+                            Container& c,
+                            scan_list_options<Separator> options) -> error
+        {
+            return scan_list_impl(
+                ctx, localized, c, options,
+                std::integral_constant<
+                    bool, Context::range_type::is_contiguous &&
+                              std::is_same<Separator, typename Context::
+                                                          char_type>::value>{});
+        }
     }  // namespace detail
 
     /**
@@ -0,0 +1,340 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_SCAN_LIST_PARALLEL_H
+#define SCN_SCAN_LIST_PARALLEL_H
+
+#include "scan.h"
+#include "list.h"
+
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    /**
+     * Result of `scan_list_parallel()`.
+     */
+    struct parallel_list_result {
+        /// `error::good`, or the first error encountered in the source
+        error err{};
+        /**
+         * Number of values written into the container.
+         * If `err` is set, this is the index of the value that failed to be
+         * scanned.
+         */
+        size_t index{0};
+        /**
+         * Offset of the first character in the source after the list.
+         * If `err` is set, this is the offset of the value that failed to be
+         * scanned.
+         */
+        size_t offset{0};
+
+        explicit operator bool() const noexcept
+        {
+            return err.operator bool();
+        }
+    };
+
+    namespace detail {
+        template <typename CharT>
+        bool is_list_boundary(CharT ch,
+                              const scan_list_options<CharT>& options) noexcept
+        {
+            return (options.separator && ch == options.separator.get()) ||
+                   is_space(ch);
+        }
+
+        // Splits `s` into at most `n` segments, each beginning at the start
+        // of a value, and ending at a separator or whitespace
+        template <typename CharT>
+        std::vector<span<const CharT>> split_list_segments(
+            span<const CharT> s,
+            const scan_list_options<CharT>& options,
+            size_t n)
+        {
+            std::vector<span<const CharT>> segments;
+            segments.reserve(n);
+
+            const auto end = s.data() + s.size();
+            auto begin = s.data();
+            for (size_t i = 1; i < n && begin != end; ++i) {
+                auto split = s.data() + s.size() / n * i;
+                if (split <= begin) {
+                    continue;
+                }
+                while (split != end && !is_list_boundary(*split, options)) {
+                    ++split;
+                }
+                auto next = split;
+                while (next != end && is_list_boundary(*next, options)) {
+                    ++next;
+                }
+                segments.push_back(span<const CharT>{
+                    begin, static_cast<size_t>(split - begin)});
+                begin = next;
+            }
+            segments.push_back(
+                span<const CharT>{begin, static_cast<size_t>(end - begin)});
+            return segments;
+        }
+
+        // Offset of the `k`th value in `s`, which only contains values and
+        // the boundaries between them
+        template <typename CharT>
+        size_t list_value_offset(span<const CharT> s,
+                                 size_t k,
+                                 const scan_list_options<CharT>& options)
+        {
+            size_t i = 0;
+            while (i != s.size() && is_list_boundary(s[i], options)) {
+                ++i;
+            }
+            for (; k != 0; --k) {
+                while (i != s.size() && !is_list_boundary(s[i], options)) {
+                    ++i;
+                }
+                while (i != s.size() && is_list_boundary(s[i], options)) {
+                    ++i;
+                }
+            }
+            return i;
+        }
+
+        // Joins every started thread, even if starting another one threw
+        struct join_threads {
+            ~join_threads()
+            {
+                for (auto& t : threads) {
+                    if (t.joinable()) {
+                        t.join();
+                    }
+                }
+            }
+
+            std::vector<std::thread>& threads;
+        };
+
+        template <typename T, typename CharT>
+        struct list_segment {
+            std::vector<T> values{};
+            error err{};
+            // offset of the remainder of the segment, where scanning stopped
+            size_t offset{0};
+#if SCN_HAS_EXCEPTIONS
+            std::exception_ptr exception{};
+#endif
+        };
+
+        template <typename T, typename CharT>
+        void scan_list_segment(list_segment<T, CharT>& seg,
+                               span<const CharT> s,
+                               const scan_list_options<CharT>& options)
+        {
+#if SCN_HAS_EXCEPTIONS
+            try {
+#endif
+                auto ret = scan_list_ex(
+                    basic_string_view<CharT>{s.data(), s.size()}, seg.values,
+                    options);
+                seg.err = ret.error();
+                auto rest = ret.range_as_string_view();
+                seg.offset = static_cast<size_t>(rest.data() - s.data());
+                if (seg.err) {
+                    // values end at the segment boundary, so only
+                    // whitespace and separators are allowed after them
+                    for (auto ch : rest) {
+                        if (!is_list_boundary(ch, options)) {
+                            seg.err = {error::invalid_scanned_value,
+                                       "Invalid value in list"};
+                            break;
+                        }
+                        ++seg.offset;
+                    }
+                }
+                else {
+                    // point at the failing value, not the whitespace
+                    // preceding it
+                    for (auto ch : rest) {
+                        if (!is_list_boundary(ch, options)) {
+                            break;
+                        }
+                        ++seg.offset;
+                    }
+                }
+#if SCN_HAS_EXCEPTIONS
+            }
+            catch (...) {
+                seg.exception = std::current_exception();
+            }
+#endif
+        }
+    }  // namespace detail
+
+    /**
+     * Otherwise equivalent to `scan_list_ex()`, except splits `r` into
+     * segments at value boundaries, and scans them on multiple threads.
+     *
+     * `r` must be a contiguous range of `char` or `wchar_t`, like a
+     * `string_view` or a `mapped_file`.
+     * Values are scanned into a `std::vector` per segment, and appended into
+     * `c` with `c.push_back` in order once every segment is done, up to
+     * `c.max_size()`.
+     * The values are scanned with the default options, and must not contain
+     * whitespace or the separator.
+     *
+     * On error, the values before the failing one are written into `c`, and
+     * the returned object holds the error, and the index and the source offset
+     * of the failing value.
+     *
+     * Not included in `<scn/scn.h>`: include `<scn/parallel.h>`, and link
+     * with the platform's thread library.
+     *
+     * \code{.cpp}
+     * scn::mapped_file f{"matrix.txt"};
+     * std::vector<double> values;
+     * auto ret = scn::scan_list_parallel(f, values, scn::list_separator(','));
+     * if (!ret) {
+     *     // ret.err, ret.index, ret.offset
+     * }
+     * \endcode
+     *
+     * \param r Range to scan from
+     * \param c Container to write read values into
+     * \param options Options to use
+     * \param threads Maximum number of threads to use, including the calling
+     * thread. If `0`, `std::thread::hardware_concurrency()` is used.
+     * \param min_segment_size Minimum number of characters scanned by a single
+     * thread
+     */
+    template <typename Range,
+              typename Container,
+              typename CharT = ranges::range_value_t<const Range>,
+              typename std::enable_if<
+                  SCN_CHECK_CONCEPT(ranges::contiguous_range<const Range>) &&
+                  SCN_CHECK_CONCEPT(ranges::sized_range<const Range>) &&
+                  (std::is_same<CharT, char>::value ||
+                   std::is_same<CharT, wchar_t>::value)>::type* = nullptr>
+    parallel_list_result scan_list_parallel(
+        const Range& r,
+        Container& c,
+        scan_list_options<CharT> options = {},
+        unsigned threads = 0,
+        size_t min_segment_size = 64 * 1024)
+    {
+        using value_type = typename Container::value_type;
+        using segment_type = detail::list_segment<value_type, CharT>;
+
+        auto source = span<const CharT>{ranges::data(r),
+                                        static_cast<size_t>(ranges::size(r))};
+        if (options.until) {
+            auto p = std::char_traits<CharT>::find(
+                source.data(), source.size(), options.until.get());
+            if (p) {
+                source = source.first(static_cast<size_t>(p - source.data()));
+            }
+        }
+
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+        size_t n = threads == 0 ? 1 : threads;
+        if (min_segment_size != 0 && source.size() / min_segment_size < n) {
+            n = source.size() / min_segment_size;
+        }
+        if (n == 0) {
+            n = 1;
+        }
+
+        auto segments = detail::split_list_segments(source, options, n);
+        std::vector<segment_type> results(segments.size());
+        {
+            std::vector<std::thread> workers;
+            workers.reserve(segments.size() - 1);
+            detail::join_threads guard{workers};
+            for (size_t i = 1; i < segments.size(); ++i) {
+                workers.emplace_back(
+                    [&, i]() {
+                        detail::scan_list_segment(results[i], segments[i],
+                                                  options);
+                    });
+            }
+            detail::scan_list_segment(results[0], segments[0], options);
+        }
+
+        parallel_list_result ret{};
+        {
+            size_t total = 0;
+            for (auto& seg : results) {
+                total += seg.values.size();
+            }
+            const auto left = c.max_size() - c.size();
+            detail::reserve_list(c, total < left ? total : left,
+                                 detail::priority_tag<2>{});
+        }
+        for (size_t i = 0; i < results.size(); ++i) {
+            auto& seg = results[i];
+#if SCN_HAS_EXCEPTIONS
+            if (seg.exception) {
+                std::rethrow_exception(seg.exception);
+            }
+#endif
+            const auto segment_offset =
+                static_cast<size_t>(segments[i].data() - source.data());
+            for (size_t j = 0; j < seg.values.size(); ++j) {
+                if (c.size() == c.max_size()) {
+                    // the list ends at the first value that didn't fit
+                    ret.offset = segment_offset +
+                                 detail::list_value_offset(segments[i], j,
+                                                           options);
+                    return ret;
+                }
+                c.push_back(SCN_MOVE(seg.values[j]));
+                ++ret.index;
+            }
+            ret.offset = segment_offset + seg.offset;
+            if (!seg.err) {
+                ret.err = seg.err;
+                return ret;
+            }
+        }
+        ret.offset = source.size();
+        return ret;
+    }
+    template <typename CharT,
+              size_t N,
+              typename Container,
+              typename SepCharT = CharT>
+    parallel_list_result scan_list_parallel(
+        const CharT (&r)[N],
+        Container& c,
+        scan_list_options<SepCharT> options = {},
+        unsigned threads = 0,
+        size_t min_segment_size = 64 * 1024)
+    {
+        static_assert(N != 0, "");
+        return scan_list_parallel(basic_string_view<CharT>{r, N - 1}, c,
+                                  options, threads, min_segment_size);
+    }
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#endif
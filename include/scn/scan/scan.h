@@ -54,6 +54,69 @@ namespace scn {
     }
 
     namespace detail {
+        // Built-in types are dispatched to their scanners by basic_visitor
+        template <typename Context, typename ParseCtx, typename T>
+        error scan_single_arg(Context& ctx,
+                              ParseCtx& pctx,
+                              T& val,
+                              std::false_type)
+        {
+            return basic_visitor<Context, ParseCtx>(ctx, pctx)(val);
+        }
+        // Custom types, like scan_custom_arg
+        template <typename Context, typename ParseCtx, typename T>
+        error scan_single_arg(Context& ctx,
+                              ParseCtx& pctx,
+                              T& val,
+                              std::true_type)
+        {
+            return visitor_boilerplate<scanner<T>>(val, ctx, pctx);
+        }
+
+        /**
+         * Scans a single value with the default options, equivalent to
+         * `vscan_default()` with a single argument.
+         *
+         * The scanner for `T` is called directly, without going through
+         * `basic_args` and `visit()`, so there's no type erasure, and no
+         * dispatch on the argument type at runtime.
+         */
+        template <typename T, typename WrappedRange>
+        vscan_result<WrappedRange> scan_single_default(WrappedRange&& r,
+                                                       T& val,
+                                                       bool trusted = false)
+        {
+            using char_type = typename WrappedRange::char_type;
+            using type_tag = get_type<char_type, T>;
+
+            auto ctx = make_context(SCN_MOVE(r));
+            ctx.set_trusted(trusted);
+            auto pctx = make_parse_context(1, ctx.locale());
+#if SCN_ENABLE_STATS
+            const auto read_before =
+                ctx.range().distance_from_rollback_point();
+#endif
+            auto err = scan_single_arg(
+                ctx, pctx, val,
+                std::integral_constant<bool, type_tag::value ==
+                                                 custom_type>{});
+#if SCN_ENABLE_STATS
+            SCN_STATS_ADD(chars_read[static_cast<size_t>(type_tag::value)],
+                          ctx.range().distance_from_rollback_point() -
+                              read_before);
+#endif
+            if (!err) {
+                auto rb = ctx.range().reset_to_rollback_point();
+                if (!rb) {
+                    err = rb;
+                }
+            }
+            else {
+                ctx.range().set_rollback_point();
+            }
+            return {err, SCN_MOVE(ctx.range())};
+        }
+
         template <typename Range, typename Format, typename... Args>
         auto scan_boilerplate(Range&& r, const Format& f, Args&... a)
             -> detail::scan_result_for_range<Range>
@@ -65,9 +128,12 @@ namespace scn {
 
             auto range = wrap(SCN_FWD(r));
             auto format = detail::to_format(f);
-            auto args = make_args_for(range, format, a...);
-            auto ret = vscan(SCN_MOVE(range), format, {args});
-            return make_scan_result<Range>(SCN_MOVE(ret));
+            using backend = vscan_backend<decltype(range)>;
+            auto&& erased = backend::erase(range);
+            auto args = make_args_for(erased, format, a...);
+            auto ret = vscan(SCN_MOVE(erased), format, {args});
+            return make_scan_result<Range>(
+                backend::restore(range, SCN_MOVE(ret)));
         }
 
         template <typename Range, typename... Args>
@@ -81,9 +147,82 @@ namespace scn {
 
             auto range = wrap(SCN_FWD(r));
             auto format = static_cast<int>(sizeof...(Args));
-            auto args = make_args_for(range, format, a...);
-            auto ret = vscan_default(SCN_MOVE(range), format, {args});
-            return make_scan_result<Range>(SCN_MOVE(ret));
+            using backend = vscan_backend<decltype(range)>;
+            auto&& erased = backend::erase(range);
+            auto args = make_args_for(erased, format, a...);
+            auto ret = vscan_default(SCN_MOVE(erased), format, {args});
+            return make_scan_result<Range>(
+                backend::restore(range, SCN_MOVE(ret)));
+        }
+        // A single argument doesn't need to be type-erased, but the range
+        // still goes through vscan_backend, so that the scanner is only
+        // instantiated for the erased range type
+        template <typename Range, typename Arg>
+        auto scan_boilerplate_default(Range&& r, Arg& a)
+            -> detail::scan_result_for_range<Range>
+        {
+            static_assert(SCN_CHECK_CONCEPT(ranges::range<Range>),
+                          "Input needs to be a Range");
+
+            auto range = wrap(SCN_FWD(r));
+            using backend = vscan_backend<decltype(range)>;
+            auto&& erased = backend::erase(range);
+            auto ret = scan_single_default(SCN_MOVE(erased), a);
+            return make_scan_result<Range>(
+                backend::restore(range, SCN_MOVE(ret)));
+        }
+
+        template <typename Range, typename Format, typename... Args>
+        auto scan_boilerplate_unchecked(Range&& r, const Format& f, Args&... a)
+            -> detail::scan_result_for_range<Range>
+        {
+            static_assert(sizeof...(Args) > 0,
+                          "Have to scan at least a single argument");
+            static_assert(SCN_CHECK_CONCEPT(ranges::range<Range>),
+                          "Input needs to be a Range");
+
+            auto range = wrap(SCN_FWD(r));
+            auto format = detail::to_format(f);
+            using backend = vscan_backend<decltype(range)>;
+            auto&& erased = backend::erase(range);
+            auto args = make_args_for(erased, format, a...);
+            auto ret = vscan_unchecked(SCN_MOVE(erased), format, {args});
+            return make_scan_result<Range>(
+                backend::restore(range, SCN_MOVE(ret)));
+        }
+
+        template <typename Range, typename... Args>
+        auto scan_boilerplate_default_unchecked(Range&& r, Args&... a)
+            -> detail::scan_result_for_range<Range>
+        {
+            static_assert(sizeof...(Args) > 0,
+                          "Have to scan at least a single argument");
+            static_assert(SCN_CHECK_CONCEPT(ranges::range<Range>),
+                          "Input needs to be a Range");
+
+            auto range = wrap(SCN_FWD(r));
+            auto format = static_cast<int>(sizeof...(Args));
+            using backend = vscan_backend<decltype(range)>;
+            auto&& erased = backend::erase(range);
+            auto args = make_args_for(erased, format, a...);
+            auto ret =
+                vscan_default_unchecked(SCN_MOVE(erased), format, {args});
+            return make_scan_result<Range>(
+                backend::restore(range, SCN_MOVE(ret)));
+        }
+        template <typename Range, typename Arg>
+        auto scan_boilerplate_default_unchecked(Range&& r, Arg& a)
+            -> detail::scan_result_for_range<Range>
+        {
+            static_assert(SCN_CHECK_CONCEPT(ranges::range<Range>),
+                          "Input needs to be a Range");
+
+            auto range = wrap(SCN_FWD(r));
+            using backend = vscan_backend<decltype(range)>;
+            auto&& erased = backend::erase(range);
+            auto ret = scan_single_default(SCN_MOVE(erased), a, true);
+            return make_scan_result<Range>(
+                backend::restore(range, SCN_MOVE(ret)));
         }
 
         template <typename Locale,
@@ -108,10 +247,13 @@ namespace scn {
                 make_locale_ref<typename decltype(range)::char_type>(loc);
             SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
 
-            auto args = make_args_for(range, format, a...);
-            auto ret = vscan_localized(SCN_MOVE(range), SCN_MOVE(locale),
+            using backend = vscan_backend<decltype(range)>;
+            auto&& erased = backend::erase(range);
+            auto args = make_args_for(erased, format, a...);
+            auto ret = vscan_localized(SCN_MOVE(erased), SCN_MOVE(locale),
                                        format, {args});
-            return make_scan_result<Range>(SCN_MOVE(ret));
+            return make_scan_result<Range>(
+                backend::restore(range, SCN_MOVE(ret)));
         }
 
     }  // namespace detail
@@ -150,6 +292,8 @@ namespace scn {
      * format string with the appropriate amount of space-separated `"{}"`s for
      * the number of arguments. Because this function doesn't have to parse the
      * format string, performance is improved.
+     * With a single argument, its scanner is called directly, without
+     * type-erasing the argument.
      *
      * Adapted from the example for \ref scan
      * \code{.cpp}
@@ -173,6 +317,76 @@ namespace scn {
     }
 #endif
 
+    // unchecked
+
+    /**
+     * Equivalent to \ref scan, except the source is trusted to contain valid
+     * values, so validation that would otherwise be done on them can be
+     * skipped.
+     *
+     * Currently, on contiguous ranges:
+     *  - integers in base 10 are read without checking for overflow.
+     *  - `float` and `double`, with the default format options and a `char`
+     *    source, are parsed in place, without first reading the value into
+     *    a null-terminated buffer. Hexfloats, and values needing the slower
+     *    fallback parsers, are passed to the regular float scanner.
+     *
+     * Other types are scanned as with \ref scan.
+     * The source is still bounds-checked, and values not matching the format
+     * at all (like `"abc"` for an `int`) still cause an error, but scanning
+     * an integer that's out of range for its type is undefined behavior.
+     * In debug builds (when `NDEBUG` is not defined), the results are
+     * checked against the regular scanners with an assertion, to catch
+     * misuse.
+     *
+     * Intended for replaying large machine-generated inputs that have
+     * already been validated.
+     *
+     * \code{.cpp}
+     * int i;
+     * scn::scan_unchecked("123", "{}", i);
+     * // i == 123
+     * \endcode
+     *
+     * \see scan
+     * \see basic_context::trusted()
+     */
+#if SCN_DOXYGEN
+    template <typename Range, typename Format, typename... Args>
+    auto scan_unchecked(Range&& r, const Format& f, Args&... a)
+        -> detail::scan_result_for_range<Range>;
+#else
+    template <typename Range, typename Format, typename... Args>
+    SCN_NODISCARD auto scan_unchecked(Range&& r, const Format& f, Args&... a)
+        -> detail::scan_result_for_range<Range>
+    {
+        return detail::scan_boilerplate_unchecked(SCN_FWD(r), f, a...);
+    }
+#endif
+
+    /**
+     * Equivalent to \ref scan_default, with the same relaxed validation as
+     * \ref scan_unchecked.
+     * Integers are read with base detection, like with \ref scan_default,
+     * so they're validated as usual: use `"{}"` with \ref scan_unchecked
+     * instead.
+     *
+     * \see scan_default
+     * \see scan_unchecked
+     */
+#if SCN_DOXYGEN
+    template <typename Range, typename... Args>
+    auto scan_default_unchecked(Range&& r, Args&... a)
+        -> detail::scan_result_for_range<Range>;
+#else
+    template <typename Range, typename... Args>
+    SCN_NODISCARD auto scan_default_unchecked(Range&& r, Args&... a)
+        -> detail::scan_result_for_range<Range>
+    {
+        return detail::scan_boilerplate_default_unchecked(SCN_FWD(r), a...);
+    }
+#endif
+
     // scan localized
 
     /**
@@ -227,6 +441,8 @@ namespace scn {
      * The parsed value is in `ret.value()`, if `ret == true`.
      * The return type of this function is otherwise similar to other scanning
      * functions.
+     * Like \ref scan_default with a single argument, the scanner for `T` is
+     * called directly, without going through `vscan_default`.
      *
      * \code{.cpp}
      * auto ret = scn::scan_value<int>("42");
@@ -246,8 +462,10 @@ namespace scn {
     {
         T value;
         auto range = wrap(SCN_FWD(r));
-        auto args = make_args_for(range, 1, value);
-        auto ret = vscan_default(SCN_MOVE(range), 1, {args});
+        using backend = detail::vscan_backend<decltype(range)>;
+        auto&& erased = backend::erase(range);
+        auto ret = backend::restore(
+            range, detail::scan_single_default(SCN_MOVE(erased), value));
         if (ret.err) {
             return detail::wrap_result(expected<T>{value},
                                        detail::range_tag<Range>{},
@@ -380,7 +598,8 @@ namespace scn {
         SCN_EXPECT(!str.empty());
         auto s = detail::float_scanner_access<T>{};
         auto ret = s._read_float(val, make_span(str.data(), str.size()),
-                                 detail::ascii_widen<CharT>('.'));
+                                 detail::ascii_widen<CharT>('.'),
+                                 get_default_resource());
         if (!ret) {
             return ret.error();
         }
@@ -21,6 +21,7 @@
 #include "../detail/context.h"
 #include "../detail/file.h"
 #include "../detail/parse_context.h"
+#include "../detail/segmented.h"
 #include "../detail/visitor.h"
 #include "common.h"
 
@@ -47,9 +48,11 @@ namespace scn {
         vscan_result<WrappedRange> vscan_boilerplate(
             WrappedRange&& r,
             basic_string_view<CharT> fmt,
-            basic_args<CharT> args)
+            basic_args<CharT> args,
+            bool trusted = false)
         {
             auto ctx = make_context(SCN_MOVE(r));
+            ctx.set_trusted(trusted);
             auto pctx = make_parse_context(fmt, ctx.locale());
             auto err = visit(ctx, pctx, SCN_MOVE(args));
             return {err, SCN_MOVE(ctx.range())};
@@ -60,9 +63,11 @@ namespace scn {
         vscan_result<WrappedRange> vscan_boilerplate_default(
             WrappedRange&& r,
             int n_args,
-            basic_args<CharT> args)
+            basic_args<CharT> args,
+            bool trusted = false)
         {
             auto ctx = make_context(SCN_MOVE(r));
+            ctx.set_trusted(trusted);
             auto pctx = make_parse_context(n_args, ctx.locale());
             auto err = visit(ctx, pctx, SCN_MOVE(args));
             return {err, SCN_MOVE(ctx.range())};
@@ -82,6 +87,81 @@ namespace scn {
             auto err = visit(ctx, pctx, SCN_MOVE(args));
             return {err, SCN_MOVE(ctx.range())};
         }
+
+        /**
+         * Selects the source range `vscan` and others are called with, when
+         * scanning from `WrappedRange`: `erase()` creates it, and
+         * `restore()` maps the result back to `WrappedRange`.
+         *
+         * By default, that's `WrappedRange` itself.
+         */
+        template <typename WrappedRange, typename = void>
+        struct vscan_backend {
+            using type = WrappedRange;
+
+            static WrappedRange& erase(WrappedRange& r) noexcept
+            {
+                return r;
+            }
+            static vscan_result<WrappedRange> restore(
+                WrappedRange&,
+                vscan_result<WrappedRange>&& ret)
+            {
+                return SCN_MOVE(ret);
+            }
+        };
+
+        template <typename WrappedRange>
+        struct is_erased_to_string_view {
+            using char_type = typename WrappedRange::char_type;
+            using range_type = typename WrappedRange::range_nocvref_type;
+
+            static constexpr bool value =
+                WrappedRange::is_contiguous && WrappedRange::is_direct &&
+                SCN_CHECK_CONCEPT(ranges::sized_range<range_type>) &&
+                (std::is_same<char_type, char>::value ||
+                 std::is_same<char_type, wchar_t>::value) &&
+                !std::is_same<range_type, basic_string_view<char_type>>::value;
+        };
+
+        /**
+         * Other contiguous ranges of `char` or `wchar_t` (`std::vector`,
+         * `std::span`, user-defined ranges...) are scanned through a
+         * `basic_string_view` over their contents, so that they share the
+         * `vscan` instantiations compiled into the library, instead of
+         * instantiating `visit()` and every scanner for their own type.
+         */
+        template <typename WrappedRange>
+        struct vscan_backend<WrappedRange,
+                             typename std::enable_if<is_erased_to_string_view<
+                                 WrappedRange>::value>::type> {
+            using char_type = typename WrappedRange::char_type;
+            using type = range_wrapper<basic_string_view<char_type>>;
+
+            static type erase(WrappedRange& r) noexcept
+            {
+                if (r.empty()) {
+                    return {basic_string_view<char_type>{}};
+                }
+                return {basic_string_view<char_type>{
+                    r.data(), static_cast<size_t>(r.size())}};
+            }
+            static vscan_result<WrappedRange> restore(WrappedRange& r,
+                                                      vscan_result<type>&& ret)
+            {
+                // Advance `r` past what was read, keeping the rollback point
+                // in the same place
+                const auto read =
+                    ret.range.begin() - ret.range.begin_underlying();
+                const auto pending = ret.range.distance_from_rollback_point();
+                r.advance(read - pending);
+                if (read != pending || ret.err) {
+                    r.set_rollback_point();
+                }
+                r.advance(pending);
+                return {ret.err, SCN_MOVE(r)};
+            }
+        };
     }  // namespace detail
 
     /**
@@ -147,6 +227,39 @@ namespace scn {
             SCN_MOVE(range), SCN_MOVE(loc), fmt, SCN_MOVE(args));
     }
 
+    /**
+     * To be used with `scan_unchecked`
+     *
+     * \see vscan
+     * \see basic_context::trusted()
+     */
+    template <typename WrappedRange,
+              typename CharT = typename WrappedRange::char_type>
+    vscan_result<WrappedRange> vscan_unchecked(WrappedRange range,
+                                               basic_string_view<CharT> fmt,
+                                               basic_args<CharT>&& args)
+    {
+        return detail::vscan_boilerplate(SCN_MOVE(range), fmt, SCN_MOVE(args),
+                                         true);
+    }
+
+    /**
+     * To be used with `scan_default_unchecked`
+     *
+     * \see vscan_default
+     * \see basic_context::trusted()
+     */
+    template <typename WrappedRange,
+              typename CharT = typename WrappedRange::char_type>
+    vscan_result<WrappedRange> vscan_default_unchecked(
+        WrappedRange range,
+        int n_args,
+        basic_args<CharT>&& args)
+    {
+        return detail::vscan_boilerplate_default(SCN_MOVE(range), n_args,
+                                                 SCN_MOVE(args), true);
+    }
+
     /**
      * \see scan_usertype
      * \see vscan
@@ -185,6 +298,15 @@ namespace scn {
         basic_string_view<detail::vscan_macro::CharAlias>,                  \
         basic_args<detail::vscan_macro::CharAlias>&&);                      \
                                                                             \
+    vscan_result<detail::vscan_macro::WrappedAlias> vscan_unchecked(        \
+        detail::vscan_macro::WrappedAlias&&,                                \
+        basic_string_view<detail::vscan_macro::CharAlias>,                  \
+        basic_args<detail::vscan_macro::CharAlias>&&);                      \
+                                                                            \
+    vscan_result<detail::vscan_macro::WrappedAlias>                         \
+    vscan_default_unchecked(detail::vscan_macro::WrappedAlias&&, int,       \
+                            basic_args<detail::vscan_macro::CharAlias>&&);  \
+                                                                            \
     error vscan_usertype(basic_context<detail::vscan_macro::WrappedAlias>&, \
                          basic_string_view<detail::vscan_macro::CharAlias>, \
                          basic_args<detail::vscan_macro::CharAlias>&&)
@@ -195,6 +317,12 @@ namespace scn {
     SCN_VSCAN_DECLARE(std::wstring, wstring_wrapped, wstring_char);
     SCN_VSCAN_DECLARE(file&, file_ref_wrapped, file_ref_char);
     SCN_VSCAN_DECLARE(wfile&, wfile_ref_wrapped, wfile_ref_char);
+    SCN_VSCAN_DECLARE(segmented_range&,
+                      segmented_range_ref_wrapped,
+                      segmented_range_ref_char);
+    SCN_VSCAN_DECLARE(wsegmented_range&,
+                      wsegmented_range_ref_wrapped,
+                      wsegmented_range_ref_char);
 
 #endif  // !SCN_HEADER_ONLY
 
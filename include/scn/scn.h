@@ -20,7 +20,12 @@
 
 #include "scan/scan.h"
 #include "scan/getline.h"
+#include "scan/intern.h"
 #include "scan/ignore.h"
+#include "scan/delimited.h"
+#include "scan/describe.h"
+#include "scan/fixed_width.h"
+#include "scan/lines.h"
 #include "scan/list.h"
 
 #endif  // SCN_SCN_H
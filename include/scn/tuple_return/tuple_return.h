@@ -58,8 +58,9 @@ namespace scn {
     {
         using result = detail::scan_result_for_range<Range>;
         using range_type = typename result::wrapped_range_type;
+        using backend = detail::vscan_backend<range_type>;
 
-        using context_type = basic_context<range_type>;
+        using context_type = basic_context<typename backend::type>;
         using parse_context_type =
             basic_parse_context<typename context_type::char_type>;
         using char_type = typename range_type::char_type;
@@ -67,8 +68,9 @@ namespace scn {
         auto range = wrap(SCN_FWD(r));
         auto scanfn = [&range, &f](Args&... a) {
             auto args = make_args<context_type, parse_context_type>(a...);
-            return vscan(SCN_MOVE(range), basic_string_view<char_type>(f),
-                         {args});
+            return backend::restore(
+                range, vscan(SCN_MOVE(backend::erase(range)),
+                             basic_string_view<char_type>(f), {args}));
         };
 
         std::tuple<Args...> values{Args{}...};
@@ -95,16 +97,19 @@ namespace scn {
     {
         using result = detail::scan_result_for_range<Range>;
         using range_type = typename result::wrapped_range_type;
+        using backend = detail::vscan_backend<range_type>;
 
-        using context_type = basic_context<range_type>;
+        using context_type = basic_context<typename backend::type>;
         using parse_context_type =
             basic_empty_parse_context<typename context_type::locale_type>;
 
         auto range = wrap(SCN_FWD(r));
         auto scanfn = [&range](Args&... a) {
             auto args = make_args<context_type, parse_context_type>(a...);
-            return vscan_default(SCN_MOVE(range),
-                                 static_cast<int>(sizeof...(Args)), {args});
+            return backend::restore(
+                range, vscan_default(SCN_MOVE(backend::erase(range)),
+                                     static_cast<int>(sizeof...(Args)),
+                                     {args}));
         };
 
         std::tuple<Args...> values{Args{}...};
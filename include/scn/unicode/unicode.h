@@ -23,6 +23,7 @@
 #ifndef SCN_UNICODE_UNICODE_H
 #define SCN_UNICODE_UNICODE_H
 
+#include "../util/span.h"
 #include "utf16.h"
 #include "utf8.h"
 
@@ -235,6 +236,111 @@ namespace scn {
             SCN_MAKE_UTF_TAG(typename std::iterator_traits<I>::value_type));
     }
 
+    namespace detail {
+        template <typename CharT>
+        error decode_code_points(const CharT*& it,
+                                 const CharT* end,
+                                 code_point*& out,
+                                 code_point* out_end,
+                                 utf8_tag)
+        {
+            return utf8::decode(it, end, out, out_end);
+        }
+        template <typename CharT>
+        error decode_code_points(const CharT*& it,
+                                 const CharT* end,
+                                 code_point*& out,
+                                 code_point* out_end,
+                                 utf16_tag)
+        {
+            return utf16::decode(it, end, out, out_end);
+        }
+        template <typename CharT>
+        error decode_code_points(const CharT*& it,
+                                 const CharT* end,
+                                 code_point*& out,
+                                 code_point* out_end,
+                                 utf32_tag)
+        {
+            const auto n = (end - it) < (out_end - out) ? (end - it)
+                                                        : (out_end - out);
+            for (std::ptrdiff_t i = 0; i != n; ++i) {
+                out[i] = make_code_point(it[i]);
+            }
+            it += n;
+            out += n;
+            return {};
+        }
+    }  // namespace detail
+
+    template <typename CharT>
+    struct decode_code_points_result {
+        /// Code units consumed from the input
+        span<const CharT> chars;
+        /// Code points written into the output
+        span<code_point> code_points;
+    };
+
+    /**
+     * Decodes the code points in `input` into `output`, until either `input`
+     * is exhausted, or `output` is full.
+     *
+     * For information on how the encoding is determined, see \ref
+     * parse_code_point().
+     *
+     * \return On success, the parts of `input` and `output` that were used.
+     * If `input` contains an incorrectly encoded code point, or ends in the
+     * middle of one, returns `error::invalid_encoding`.
+     */
+    template <typename CharT>
+    expected<decode_code_points_result<CharT>> decode_code_points(
+        span<const CharT> input,
+        span<code_point> output)
+    {
+        auto it = input.begin();
+        auto out = output.begin();
+        auto e = detail::decode_code_points(it, input.end(), out,
+                                            output.end(),
+                                            SCN_MAKE_UTF_TAG(CharT));
+        if (!e) {
+            return e;
+        }
+        if (it != input.end() && out != output.end()) {
+            return error(error::invalid_encoding,
+                         "Unexpected end of range when decoding code points "
+                         "(partial codepoint)");
+        }
+        return decode_code_points_result<CharT>{
+            make_span(input.begin(), it), make_span(output.begin(), out)};
+    }
+
+    /**
+     * Decodes all of the code points in `input`, and appends them to
+     * `output`.
+     *
+     * `Container` must have `value_type` of `code_point`, and provide member
+     * functions `size()`, `resize()` and `data()`,
+     * like `std::vector<code_point>` or `small_vector<code_point, N>`.
+     *
+     * \return If `input` is encoded incorrectly, returns
+     * `error::invalid_encoding`, and `output` is left unchanged.
+     */
+    template <typename CharT, typename Container>
+    error decode_code_points(span<const CharT> input, Container& output)
+    {
+        const auto old_size = output.size();
+        output.resize(old_size + input.size());
+
+        auto ret = decode_code_points(
+            input, make_span(output.data() + old_size, input.size()));
+        if (!ret) {
+            output.resize(old_size);
+            return ret.error();
+        }
+        output.resize(old_size + ret.value().code_points.size());
+        return {};
+    }
+
 #undef SCN_MAKE_UTF_TAG
 
     SCN_END_NAMESPACE
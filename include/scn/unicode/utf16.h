@@ -131,6 +131,45 @@ namespace scn {
                 }
                 return {dist};
             }
+
+            /**
+             * Decodes code points from `[it, end)` into `[out, out_end)`,
+             * until either one of them is exhausted.
+             *
+             * `it` and `out` are advanced past the code units consumed and
+             * the code points written. A lead surrogate at the very end of
+             * the input is left unconsumed, so that the caller can complete
+             * it with more input.
+             */
+            template <typename CharT>
+            error decode(const CharT*& it,
+                         const CharT* end,
+                         code_point*& out,
+                         code_point* out_end)
+            {
+                static_assert(sizeof(CharT) == 2, "");
+
+                while (it != end && out != out_end) {
+                    const auto ch = mask16(*it);
+                    if (SCN_LIKELY(!is_surrogate(ch))) {
+                        *out++ = make_code_point(ch);
+                        ++it;
+                        continue;
+                    }
+                    if (is_lead_surrogate(ch) && end - it < 2) {
+                        break;
+                    }
+
+                    auto tmp = it;
+                    auto e = validate_next(tmp, end, *out);
+                    if (!e) {
+                        return e;
+                    }
+                    it = tmp;
+                    ++out;
+                }
+                return {};
+            }
         }  // namespace utf16
     }      // namespace detail
 
@@ -27,6 +27,8 @@
 #include "../util/expected.h"
 #include "common.h"
 
+#include <cstring>
+
 namespace scn {
     SCN_BEGIN_NAMESPACE
 
@@ -288,6 +290,60 @@ namespace scn {
                 return {dist};
             }
 
+            /**
+             * Decodes code points from `[it, end)` into `[out, out_end)`,
+             * until either one of them is exhausted.
+             *
+             * Runs of ASCII are checked and widened eight code units at a
+             * time; everything else goes through `validate_next()`.
+             *
+             * `it` and `out` are advanced past the code units consumed and
+             * the code points written. A code point cut short by `end` is
+             * left unconsumed, so that the caller can complete it with more
+             * input.
+             */
+            template <typename CharT>
+            error decode(const CharT*& it,
+                         const CharT* end,
+                         code_point*& out,
+                         code_point* out_end)
+            {
+                static_assert(sizeof(CharT) == 1, "");
+
+                while (it != end && out != out_end) {
+                    if (end - it >= 8 && out_end - out >= 8) {
+                        uint64_t word;
+                        std::memcpy(&word, it, 8);
+                        if ((word & 0x8080808080808080ull) == 0) {
+                            for (int i = 0; i != 8; ++i) {
+                                out[i] = make_code_point(mask8(it[i]));
+                            }
+                            it += 8;
+                            out += 8;
+                            continue;
+                        }
+                    }
+
+                    const auto len = get_sequence_length(*it);
+                    if (len == 1) {
+                        *out++ = make_code_point(mask8(*it++));
+                        continue;
+                    }
+                    if (len != 0 && end - it < len) {
+                        break;
+                    }
+
+                    auto tmp = it;
+                    auto e = validate_next(tmp, end, *out);
+                    if (!e) {
+                        return e;
+                    }
+                    it = tmp;
+                    ++out;
+                }
+                return {};
+            }
+
         }  // namespace utf8
     }      // namespace detail
 
@@ -0,0 +1,382 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_UTIL_MEMORY_RESOURCE_H
+#define SCN_UTIL_MEMORY_RESOURCE_H
+
+#include "../detail/fwd.h"
+#include "stats.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <type_traits>
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    /**
+     * Source of memory for the temporaries the library allocates while
+     * scanning.
+     *
+     * A stripped-down version of `std::pmr::memory_resource`, available in
+     * C++11.
+     */
+    class memory_resource {
+    public:
+        static constexpr size_t max_align = alignof(std::max_align_t);
+
+        memory_resource() = default;
+        memory_resource(const memory_resource&) = default;
+        memory_resource& operator=(const memory_resource&) = default;
+        virtual ~memory_resource() = default;
+
+        void* allocate(size_t bytes, size_t alignment = max_align)
+        {
+            return do_allocate(bytes, alignment);
+        }
+        void deallocate(void* p, size_t bytes, size_t alignment = max_align)
+        {
+            do_deallocate(p, bytes, alignment);
+        }
+
+        bool is_equal(const memory_resource& other) const noexcept
+        {
+            return do_is_equal(other);
+        }
+
+    private:
+        virtual void* do_allocate(size_t bytes, size_t alignment) = 0;
+        virtual void do_deallocate(void* p,
+                                   size_t bytes,
+                                   size_t alignment) = 0;
+        virtual bool do_is_equal(const memory_resource& other) const noexcept
+        {
+            return this == &other;
+        }
+    };
+
+    inline bool operator==(const memory_resource& a,
+                           const memory_resource& b) noexcept
+    {
+        return &a == &b || a.is_equal(b);
+    }
+    inline bool operator!=(const memory_resource& a,
+                           const memory_resource& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    namespace detail {
+        class new_delete_resource_type : public memory_resource {
+        private:
+            void* do_allocate(size_t bytes, size_t) override
+            {
+                SCN_STATS_ADD(allocations, 1);
+                SCN_STATS_ADD(allocated_bytes, bytes);
+                return ::operator new(bytes);
+            }
+            void do_deallocate(void* p, size_t, size_t) override
+            {
+                ::operator delete(p);
+            }
+        };
+    }  // namespace detail
+
+    SCN_CLANG_PUSH
+    SCN_CLANG_IGNORE("-Wexit-time-destructors")
+
+    /**
+     * Returns a resource that uses the global `operator new` and `operator
+     * delete`.
+     */
+    inline memory_resource* new_delete_resource() noexcept
+    {
+        static detail::new_delete_resource_type r{};
+        return &r;
+    }
+
+    namespace detail {
+        inline memory_resource*& default_resource_ref() noexcept
+        {
+            static thread_local memory_resource* p{new_delete_resource()};
+            return p;
+        }
+    }  // namespace detail
+
+    SCN_CLANG_POP
+
+    /**
+     * Returns the resource that new scanning contexts on this thread use.
+     * Initially `new_delete_resource()`.
+     */
+    inline memory_resource* get_default_resource() noexcept
+    {
+        return detail::default_resource_ref();
+    }
+    /**
+     * Sets the resource that new scanning contexts on this thread use.
+     * If `r` is `nullptr`, `new_delete_resource()` is used instead.
+     *
+     * \return The previous default resource
+     */
+    inline memory_resource* set_default_resource(memory_resource* r) noexcept
+    {
+        auto& ref = detail::default_resource_ref();
+        auto old = ref;
+        ref = r ? r : new_delete_resource();
+        return old;
+    }
+
+    /**
+     * Sets the default resource for the lifetime of this object, and restores
+     * the previous one on destruction.
+     *
+     * \code{.cpp}
+     * scn::monotonic_buffer_resource arena{};
+     * for (auto& batch : batches) {
+     *     scn::scoped_default_resource guard{&arena};
+     *     for (auto& record : batch) {
+     *         auto ret = scn::scan(record, ...);
+     *     }
+     *     arena.release();
+     * }
+     * \endcode
+     */
+    class scoped_default_resource {
+    public:
+        explicit scoped_default_resource(memory_resource* r) noexcept
+            : m_old(set_default_resource(r))
+        {
+        }
+
+        scoped_default_resource(const scoped_default_resource&) = delete;
+        scoped_default_resource& operator=(const scoped_default_resource&) =
+            delete;
+
+        ~scoped_default_resource()
+        {
+            set_default_resource(m_old);
+        }
+
+    private:
+        memory_resource* m_old;
+    };
+
+    /**
+     * A resource that hands out memory from a growing list of blocks, and
+     * only frees it on `release()` or destruction.
+     * Deallocation is a no-op.
+     *
+     * Suitable for per-record or per-batch parsing, where every temporary
+     * dies at the same time.
+     */
+    class monotonic_buffer_resource : public memory_resource {
+    public:
+        /**
+         * \param initial_size Size of the first block allocated from
+         * `upstream`. Subsequent blocks double in size.
+         */
+        explicit monotonic_buffer_resource(
+            size_t initial_size = 1024,
+            memory_resource* upstream = new_delete_resource())
+            : m_upstream(upstream), m_next_size(initial_size)
+        {
+            SCN_EXPECT(upstream);
+        }
+        /**
+         * Hands out memory from `buffer` first, then from `upstream`.
+         * `buffer` is never freed by this resource.
+         */
+        monotonic_buffer_resource(
+            void* buffer,
+            size_t size,
+            memory_resource* upstream = new_delete_resource())
+            : m_upstream(upstream),
+              m_initial(buffer),
+              m_initial_size(size),
+              m_current(static_cast<unsigned char*>(buffer)),
+              m_space(size),
+              m_next_size(size * 2)
+        {
+            SCN_EXPECT(upstream);
+        }
+
+        monotonic_buffer_resource(const monotonic_buffer_resource&) = delete;
+        monotonic_buffer_resource& operator=(
+            const monotonic_buffer_resource&) = delete;
+
+        ~monotonic_buffer_resource() override
+        {
+            release();
+        }
+
+        /**
+         * Frees every block allocated from upstream, and starts again from
+         * the initial buffer, if any.
+         * Invalidates all memory handed out by this resource.
+         */
+        void release() noexcept
+        {
+            while (m_blocks) {
+                auto b = m_blocks;
+                m_blocks = b->next;
+                m_upstream->deallocate(b, b->size, alignof(block));
+            }
+            m_current = static_cast<unsigned char*>(m_initial);
+            m_space = m_initial_size;
+        }
+
+        memory_resource* upstream_resource() const noexcept
+        {
+            return m_upstream;
+        }
+
+    private:
+        struct block {
+            block* next;
+            size_t size;
+        };
+
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            auto p = _align(bytes, alignment);
+            if (SCN_UNLIKELY(!p)) {
+                _next_block(bytes + alignment);
+                p = _align(bytes, alignment);
+                SCN_ENSURE(p);
+            }
+            m_current = static_cast<unsigned char*>(p) + bytes;
+            m_space -= bytes;
+            return p;
+        }
+        void do_deallocate(void*, size_t, size_t) override {}
+
+        void* _align(size_t bytes, size_t alignment) noexcept
+        {
+            if (!m_current) {
+                return nullptr;
+            }
+            const auto addr = reinterpret_cast<std::uintptr_t>(m_current);
+            const auto padding = static_cast<size_t>(
+                (alignment - addr % alignment) % alignment);
+            if (padding + bytes > m_space) {
+                return nullptr;
+            }
+            m_current += padding;
+            m_space -= padding;
+            return m_current;
+        }
+
+        void _next_block(size_t min_size)
+        {
+            auto size = m_next_size < min_size ? min_size : m_next_size;
+            size += sizeof(block);
+            auto b = static_cast<block*>(
+                m_upstream->allocate(size, alignof(block)));
+            b->next = m_blocks;
+            b->size = size;
+            m_blocks = b;
+
+            m_current = reinterpret_cast<unsigned char*>(b + 1);
+            m_space = size - sizeof(block);
+            m_next_size = m_next_size * 2;
+        }
+
+        memory_resource* m_upstream;
+        void* m_initial{nullptr};
+        size_t m_initial_size{0};
+        block* m_blocks{nullptr};
+        unsigned char* m_current{nullptr};
+        size_t m_space{0};
+        size_t m_next_size;
+    };
+
+    /**
+     * An allocator drawing from a `memory_resource`.
+     * A stripped-down version of `std::pmr::polymorphic_allocator`.
+     */
+    template <typename T>
+    class polymorphic_allocator {
+    public:
+        using value_type = T;
+
+        polymorphic_allocator() noexcept
+            : m_resource(get_default_resource())
+        {
+        }
+        polymorphic_allocator(memory_resource* r) noexcept : m_resource(r)
+        {
+            SCN_EXPECT(r);
+        }
+        template <typename U>
+        polymorphic_allocator(const polymorphic_allocator<U>& o) noexcept
+            : m_resource(o.resource())
+        {
+        }
+
+        T* allocate(size_t n)
+        {
+            return static_cast<T*>(
+                m_resource->allocate(n * sizeof(T), alignof(T)));
+        }
+        void deallocate(T* p, size_t n)
+        {
+            m_resource->deallocate(p, n * sizeof(T), alignof(T));
+        }
+
+        memory_resource* resource() const noexcept
+        {
+            return m_resource;
+        }
+
+        polymorphic_allocator select_on_container_copy_construction() const
+        {
+            return {};
+        }
+
+    private:
+        memory_resource* m_resource;
+    };
+
+    template <typename T, typename U>
+    bool operator==(const polymorphic_allocator<T>& a,
+                    const polymorphic_allocator<U>& b) noexcept
+    {
+        return *a.resource() == *b.resource();
+    }
+    template <typename T, typename U>
+    bool operator!=(const polymorphic_allocator<T>& a,
+                    const polymorphic_allocator<U>& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    namespace detail {
+        /// `std::basic_string` using a `polymorphic_allocator`
+        template <typename CharT>
+        using resource_string =
+            std::basic_string<CharT,
+                              std::char_traits<CharT>,
+                              polymorphic_allocator<CharT>>;
+    }  // namespace detail
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#endif  // SCN_UTIL_MEMORY_RESOURCE_H
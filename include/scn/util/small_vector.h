@@ -20,6 +20,7 @@
 
 #include "math.h"
 #include "memory.h"
+#include "stats.h"
 
 #include <cstdint>
 #include <cstring>
@@ -209,6 +210,8 @@ namespace scn {
                     auto& heap = _construct_heap_storage();
                     auto cap = next_pow2(count);
                     auto storage_ptr = new unsigned char[count * sizeof(T)];
+                    SCN_STATS_ADD(allocations, 1);
+                    SCN_STATS_ADD(allocated_bytes, count * sizeof(T));
                     auto ptr =
                         static_cast<pointer>(static_cast<void*>(storage_ptr));
                     uninitialized_fill(ptr, ptr + count, value);
@@ -237,6 +240,8 @@ namespace scn {
                     auto& heap = _construct_heap_storage();
                     auto cap = next_pow2(count);
                     auto storage_ptr = new unsigned char[count * sizeof(T)];
+                    SCN_STATS_ADD(allocations, 1);
+                    SCN_STATS_ADD(allocated_bytes, count * sizeof(T));
                     auto ptr =
                         static_cast<pointer>(static_cast<void*>(storage_ptr));
                     uninitialized_fill_value_init(ptr, ptr + count);
@@ -273,6 +278,10 @@ namespace scn {
                     auto optr = other.data();
 
                     auto storage_ptr = new unsigned char[cap * sizeof(T)];
+
+                    SCN_STATS_ADD(allocations, 1);
+
+                    SCN_STATS_ADD(allocated_bytes, cap * sizeof(T));
                     auto ptr =
                         static_cast<pointer>(static_cast<void*>(storage_ptr));
                     uninitialized_copy(optr, optr + s, ptr);
@@ -355,6 +364,8 @@ namespace scn {
 
                     auto cap = next_pow2(other.size());
                     auto storage_ptr = new unsigned char[cap * sizeof(T)];
+                    SCN_STATS_ADD(allocations, 1);
+                    SCN_STATS_ADD(allocated_bytes, cap * sizeof(T));
                     auto ptr =
                         static_cast<pointer>(static_cast<void*>(storage_ptr));
                     uninitialized_copy(other.data(),
@@ -650,7 +661,7 @@ namespace scn {
             {
                 if (count > size()) {
                     if (count > capacity()) {
-                        _realloc(next_pow2(capacity()));
+                        _realloc(next_pow2(count));
                     }
                     uninitialized_fill_value_init(begin() + size(),
                                                   begin() + count);
@@ -725,6 +736,8 @@ namespace scn {
             void _realloc(size_type new_cap)
             {
                 auto storage_ptr = new unsigned char[new_cap * sizeof(T)];
+                SCN_STATS_ADD(allocations, 1);
+                SCN_STATS_ADD(allocated_bytes, new_cap * sizeof(T));
                 auto ptr =
                     static_cast<pointer>(static_cast<void*>(storage_ptr));
                 auto n = size();
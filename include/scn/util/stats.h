@@ -0,0 +1,118 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_UTIL_STATS_H
+#define SCN_UTIL_STATS_H
+
+#include "../detail/fwd.h"
+
+#include <cstdint>
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    /**
+     * Counters of what the library does while scanning, for finding out why
+     * a given format or source is slow.
+     *
+     * Only updated if the library is built with `SCN_ENABLE_STATS`:
+     * otherwise, every counter stays at zero.
+     * The counters are thread-local.
+     *
+     * \see get_scan_stats()
+     * \see reset_scan_stats()
+     */
+    struct scan_stats {
+        /**
+         * Number of heap allocations made by the library.
+         *
+         * Only two sources are counted: the default memory resource
+         * (`new_delete_resource()`), used for the scratch buffers of the
+         * scanners, and heap storage of `small_vector`.
+         * Allocations made by standard containers, like the buffers of
+         * `basic_file` and `std::string` values scanned into, and by
+         * `std::locale` aren't counted, and neither are allocations from
+         * other memory resources, unless they forward to
+         * `new_delete_resource()`.
+         */
+        std::uint64_t allocations{0};
+        /// Total size of the allocations counted by `allocations`, in bytes
+        std::uint64_t allocated_bytes{0};
+
+        /**
+         * Code units read by scanners, indexed by argument type.
+         * Use `chars_read_for<T>()` to get the count for a type.
+         */
+        std::uint64_t chars_read[32] = {0};
+
+        /// Number of calls to `putback_n()`
+        std::uint64_t putbacks{0};
+        /// Total number of code units put back with `putback_n()`
+        std::uint64_t putback_chars{0};
+        /// Number of times a range was reset to its rollback point
+        std::uint64_t rollbacks{0};
+
+        /**
+         * Number of characters read from the `FILE*` of a `basic_file`,
+         * one at a time with `fgetc`, or in blocks with `fread`
+         */
+        std::uint64_t file_reads{0};
+        /// Number of characters put back with `ungetc` into a `basic_file`
+        std::uint64_t file_ungets{0};
+
+        /// Number of floats parsed with `std::from_chars`
+        std::uint64_t float_from_chars{0};
+        /// Number of floats parsed with `std::strtod` and friends
+        std::uint64_t float_strtod{0};
+    };
+
+    namespace detail {
+        inline scan_stats& stats_ref() noexcept
+        {
+            static thread_local scan_stats s{};
+            return s;
+        }
+    }  // namespace detail
+
+    /**
+     * Returns the counters for the current thread.
+     */
+    inline scan_stats get_scan_stats() noexcept
+    {
+        return detail::stats_ref();
+    }
+    /**
+     * Sets every counter for the current thread to zero.
+     */
+    inline void reset_scan_stats() noexcept
+    {
+        detail::stats_ref() = scan_stats{};
+    }
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#if SCN_ENABLE_STATS
+#define SCN_STATS_ADD(counter, n)          \
+    static_cast<void>(                     \
+        ::scn::detail::stats_ref().counter += \
+        static_cast<std::uint64_t>(n))
+#else
+#define SCN_STATS_ADD(counter, n) static_cast<void>(0)
+#endif
+
+#endif  // SCN_UTIL_STATS_H
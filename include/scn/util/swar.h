@@ -0,0 +1,74 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_UTIL_SWAR_H
+#define SCN_UTIL_SWAR_H
+
+#include "../detail/fwd.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    namespace detail {
+        // Helpers for processing 8 narrow characters at a time in a 64-bit
+        // word (SWAR), used by the integer, time and address scanners
+
+        /// `0x01` in every byte
+        static constexpr std::uint64_t swar_ones = 0x0101010101010101ull;
+        /// `0x80` in every byte
+        static constexpr std::uint64_t swar_high = 0x8080808080808080ull;
+
+        /**
+         * Loads 8 characters from `p`, the first one into the lowest byte,
+         * regardless of endianness.
+         */
+        inline std::uint64_t swar_load(const char* p) noexcept
+        {
+            std::uint64_t w;
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            std::memcpy(&w, p, sizeof(w));
+#else
+            w = 0;
+            for (int i = 7; i >= 0; --i) {
+                w = (w << 8u) | static_cast<unsigned char>(p[i]);
+            }
+#endif
+            return w;
+        }
+
+        /**
+         * Returns `w` with the high bit set in every byte within
+         * `[lo, hi]`, and every other bit cleared.
+         * Every byte of `w` has to be < `0x80`.
+         */
+        constexpr std::uint64_t swar_between(std::uint64_t w,
+                                             unsigned lo,
+                                             unsigned hi) noexcept
+        {
+            return (w + swar_ones * (0x80u - lo)) &
+                   ~(w + swar_ones * (0x7fu - hi)) & swar_high;
+        }
+    }  // namespace detail
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#endif  // SCN_UTIL_SWAR_H
@@ -22,8 +22,10 @@
 #include <scn/detail/error.h>
 #include <scn/detail/file.h>
 #include <scn/util/expected.h>
+#include <scn/util/stats.h>
 
 #include <cstdio>
+#include <cstring>
 
 #if SCN_POSIX
 #include <fcntl.h>
@@ -255,6 +257,7 @@ namespace scn {
     SCN_FUNC expected<char> file::_read_single() const
     {
         SCN_EXPECT(valid());
+        SCN_STATS_ADD(file_reads, 1);
         int tmp = std::fgetc(m_file);
         if (tmp == EOF) {
             if (std::feof(m_file) != 0) {
@@ -267,6 +270,7 @@ namespace scn {
                          "Unknown fgetc error");
         }
         auto ch = static_cast<char>(tmp);
+        _reserve(1);
         m_buffer.push_back(ch);
         return ch;
     }
@@ -274,6 +278,7 @@ namespace scn {
     SCN_FUNC expected<wchar_t> wfile::_read_single() const
     {
         SCN_EXPECT(valid());
+        SCN_STATS_ADD(file_reads, 1);
         wint_t tmp = std::fgetwc(m_file);
         if (tmp == WEOF) {
             if (std::feof(m_file) != 0) {
@@ -286,15 +291,104 @@ namespace scn {
                          "Unknown fgetc error");
         }
         auto ch = static_cast<wchar_t>(tmp);
+        _reserve(1);
         m_buffer.push_back(ch);
         return ch;
     }
 
+    template <>
+    SCN_FUNC expected<std::ptrdiff_t> file::discard_until(file::iterator it,
+                                                          char until,
+                                                          std::ptrdiff_t n,
+                                                          bool keep) const
+    {
+        SCN_EXPECT(valid());
+        SCN_EXPECT(it.m_current == m_buffer.size());
+        SCN_UNUSED(it);
+
+        char block[BUFSIZ];
+        std::ptrdiff_t kept = 0;
+        while (n > 0) {
+            const auto want = n < static_cast<std::ptrdiff_t>(sizeof(block))
+                                  ? static_cast<size_t>(n)
+                                  : sizeof(block);
+            const auto got = std::fread(block, 1, want, m_file);
+            SCN_STATS_ADD(file_reads, got);
+            const char* const last = block + got;
+            const auto found =
+                static_cast<const char*>(std::memchr(block, until, got));
+            const char* const first = found ? found : last;
+            // `until`, and everything after it, is read ahead as usual
+            const char* const keep_from = keep ? block : first;
+            _reserve(static_cast<size_t>(last - keep_from));
+            m_buffer.append(keep_from, static_cast<size_t>(last - keep_from));
+            if (keep) {
+                kept += first - block;
+            }
+            if (found) {
+                return kept;
+            }
+            if (got < want) {
+                if (std::feof(m_file) != 0) {
+                    return error(error::end_of_range, "EOF");
+                }
+                if (std::ferror(m_file) != 0) {
+                    return error(error::source_error, "fread error");
+                }
+                return error(error::unrecoverable_source_error,
+                             "Unknown fread error");
+            }
+            n -= static_cast<std::ptrdiff_t>(got);
+        }
+        return kept;
+    }
+    template <>
+    SCN_FUNC expected<std::ptrdiff_t> wfile::discard_until(wfile::iterator it,
+                                                           wchar_t until,
+                                                           std::ptrdiff_t n,
+                                                           bool keep) const
+    {
+        SCN_EXPECT(valid());
+        SCN_EXPECT(it.m_current == m_buffer.size());
+        SCN_UNUSED(it);
+
+        // Wide-oriented streams can't be read with fread,
+        // so this goes a character at a time
+        std::ptrdiff_t kept = 0;
+        for (; n > 0; --n) {
+            SCN_STATS_ADD(file_reads, 1);
+            wint_t tmp = std::fgetwc(m_file);
+            if (tmp == WEOF) {
+                if (std::feof(m_file) != 0) {
+                    return error(error::end_of_range, "EOF");
+                }
+                if (std::ferror(m_file) != 0) {
+                    return error(error::source_error, "fgetc error");
+                }
+                return error(error::unrecoverable_source_error,
+                             "Unknown fgetc error");
+            }
+            const auto ch = static_cast<wchar_t>(tmp);
+            if (ch == until) {
+                _reserve(1);
+                m_buffer.push_back(until);
+                return kept;
+            }
+            if (keep) {
+                _reserve(1);
+                m_buffer.push_back(ch);
+                ++kept;
+            }
+        }
+        return kept;
+    }
+
     template <>
     SCN_FUNC void file::_sync_until(std::size_t pos) noexcept
     {
         for (auto it = m_buffer.rbegin();
              it != m_buffer.rend() - static_cast<std::ptrdiff_t>(pos); ++it) {
+            SCN_STATS_ADD(file_ungets, 1);
             std::ungetc(static_cast<unsigned char>(*it), m_file);
         }
     }
@@ -303,6 +397,7 @@ namespace scn {
     {
         for (auto it = m_buffer.rbegin();
              it != m_buffer.rend() - static_cast<std::ptrdiff_t>(pos); ++it) {
+            SCN_STATS_ADD(file_ungets, 1);
             std::ungetwc(static_cast<wint_t>(*it), m_file);
         }
     }
@@ -45,7 +45,71 @@ namespace scn {
             string_type falsename{};
             char_type decimal_point{};
             char_type thousands_separator{};
+
+            // Classification of code units 0-255, ctype_mask bits
+            array<uint16_t, 256> ctype_table{{0}};
+            // Used for everything not in ctype_table
+            const std::ctype<wchar_t>* wide_ctype{nullptr};
+        };
+
+        struct ctype_mask_mapping {
+            std::ctype_base::mask std_mask;
+            uint16_t mask;
         };
+        static inline span<const ctype_mask_mapping> get_ctype_mask_mappings()
+        {
+            static const ctype_mask_mapping mappings[] = {
+                {std::ctype_base::space, ctype_space},
+                {std::ctype_base::print, ctype_print},
+                {std::ctype_base::cntrl, ctype_cntrl},
+                {std::ctype_base::upper, ctype_upper},
+                {std::ctype_base::lower, ctype_lower},
+                {std::ctype_base::alpha, ctype_alpha},
+                {std::ctype_base::digit, ctype_digit},
+                {std::ctype_base::punct, ctype_punct},
+                {std::ctype_base::xdigit, ctype_xdigit},
+                {std::ctype_base::blank, ctype_blank},
+                {std::ctype_base::alnum, ctype_alnum},
+                {std::ctype_base::graph, ctype_graph},
+            };
+            return {mappings, 12};
+        }
+        static inline std::ctype_base::mask to_std_ctype_mask(uint16_t mask)
+        {
+            auto ret = std::ctype_base::mask{};
+            for (const auto& m : get_ctype_mask_mappings()) {
+                if ((mask & m.mask) != 0) {
+                    ret = static_cast<std::ctype_base::mask>(ret | m.std_mask);
+                }
+            }
+            return ret;
+        }
+
+        template <typename CharT>
+        void fill_ctype_table(array<uint16_t, 256>& table,
+                              const std::locale& loc)
+        {
+            const auto& facet = std::use_facet<std::ctype<CharT>>(loc);
+
+            CharT chars[256];
+            std::ctype_base::mask masks[256];
+            for (size_t i = 0; i < 256; ++i) {
+                chars[i] = static_cast<CharT>(
+                    static_cast<typename std::make_unsigned<CharT>::type>(i));
+            }
+            facet.is(chars, chars + 256, masks);
+
+            const auto mappings = get_ctype_mask_mappings();
+            for (size_t i = 0; i < 256; ++i) {
+                uint16_t m = 0;
+                for (const auto& mapping : mappings) {
+                    if ((masks[i] & mapping.std_mask) != 0) {
+                        m = static_cast<uint16_t>(m | mapping.mask);
+                    }
+                }
+                table[i] = m;
+            }
+        }
 
         template <typename CharT>
         const std::locale& to_locale(const basic_custom_locale_ref<CharT>& l)
@@ -92,6 +156,11 @@ namespace scn {
             data.falsename = facet.falsename();
             data.decimal_point = facet.decimal_point();
             data.thousands_separator = facet.thousands_sep();
+
+            fill_ctype_table<CharT>(data.ctype_table, to_locale(*this));
+            data.wide_ctype =
+                &std::use_facet<std::ctype<wchar_t>>(to_locale(*this));
+            m_ctype_table = data.ctype_table.data();
         }
 
         template <typename CharT>
@@ -103,6 +172,7 @@ namespace scn {
 
             o.m_data = nullptr;
             o.m_locale = nullptr;
+            o.m_ctype_table = nullptr;
 
             _initialize();
         }
@@ -117,6 +187,7 @@ namespace scn {
 
             o.m_data = nullptr;
             o.m_locale = nullptr;
+            o.m_ctype_table = nullptr;
 
             _initialize();
 
@@ -143,23 +214,25 @@ namespace scn {
         {
             m_locale =
                 &static_cast<locale_data<CharT>*>(m_data)->classic_locale;
+            _initialize();
         }
         template <typename CharT>
         void basic_custom_locale_ref<CharT>::convert_to_global()
         {
             SCN_EXPECT(m_data);
             m_locale = &static_cast<locale_data<CharT>*>(m_data)->global_locale;
+            _initialize();
         }
 
         template <typename CharT>
         bool basic_custom_locale_ref<CharT>::do_is_space(char_type ch) const
         {
-            return std::isspace(ch, to_locale(*this));
+            return is_ctype(ctype_space, ch);
         }
         template <typename CharT>
         bool basic_custom_locale_ref<CharT>::do_is_digit(char_type ch) const
         {
-            return std::isdigit(ch, to_locale(*this));
+            return is_ctype(ctype_digit, ch);
         }
 
         template <typename CharT>
@@ -255,109 +328,36 @@ namespace scn {
         bool basic_custom_locale_ref<CharT>::do_is_space(
             span<const char_type> ch) const
         {
-            const auto& locale = to_locale(*this);
-            if SCN_CONSTEXPRIF (sizeof(CharT) == 1) {
-                SCN_EXPECT(ch.size() >= 1);
-                code_point cp{};
-                auto it = parse_code_point(ch.begin(), ch.end(), cp);
-                SCN_EXPECT(it);
-                return is_space(cp);
-            }
-            SCN_EXPECT(ch.size() == 1);
-            return std::isspace(ch[0], locale);
+            return is_ctype(ctype_space, ch);
         }
         template <typename CharT>
         bool basic_custom_locale_ref<CharT>::do_is_digit(
             span<const char_type> ch) const
         {
-            const auto& locale = to_locale(*this);
-            if SCN_CONSTEXPRIF (sizeof(CharT) == 1) {
-                SCN_EXPECT(ch.size() >= 1);
-                code_point cp{};
-                auto it = parse_code_point(ch.begin(), ch.end(), cp);
-                SCN_EXPECT(it);
-                return is_digit(cp);
-            }
-            SCN_EXPECT(ch.size() == 1);
-            return std::isdigit(ch[0], locale);
-        }
-
-#define SCN_DEFINE_CUSTOM_LOCALE_CTYPE(f)                                 \
-    template <typename CharT>                                             \
-    bool basic_custom_locale_ref<CharT>::is_##f(char_type ch) const       \
-    {                                                                     \
-        return std::is##f(ch, to_locale(*this));                          \
-    }                                                                     \
-    template <typename CharT>                                             \
-    bool basic_custom_locale_ref<CharT>::is_##f(code_point cp) const      \
-    {                                                                     \
-        return std::is##f(static_cast<wchar_t>(cp), to_locale(*this));    \
-    }                                                                     \
-    template <typename CharT>                                             \
-    bool basic_custom_locale_ref<CharT>::is_##f(span<const char_type> ch) \
-        const                                                             \
-    {                                                                     \
-        const auto& locale = to_locale(*this);                            \
-        if SCN_CONSTEXPRIF (sizeof(CharT) == 1) {                                         \
-            SCN_EXPECT(ch.size() >= 1);                                   \
-            code_point cp{};                                              \
-            auto it = parse_code_point(ch.begin(), ch.end(), cp);         \
-            SCN_EXPECT(it);                                               \
-            return is_##f(cp);                                            \
-        }                                                                 \
-        SCN_EXPECT(ch.size() == 1);                                       \
-        return std::is##f(ch[0], locale);                                 \
-    }
-        SCN_DEFINE_CUSTOM_LOCALE_CTYPE(alnum)
-        SCN_DEFINE_CUSTOM_LOCALE_CTYPE(alpha)
-        SCN_DEFINE_CUSTOM_LOCALE_CTYPE(cntrl)
-        SCN_DEFINE_CUSTOM_LOCALE_CTYPE(graph)
-        SCN_DEFINE_CUSTOM_LOCALE_CTYPE(lower)
-        SCN_DEFINE_CUSTOM_LOCALE_CTYPE(print)
-        SCN_DEFINE_CUSTOM_LOCALE_CTYPE(punct)
-        SCN_DEFINE_CUSTOM_LOCALE_CTYPE(upper)
-        SCN_DEFINE_CUSTOM_LOCALE_CTYPE(xdigit)
-#undef SCN_DEFINE_CUSTOM_LOCALE_CTYPE
-
-        template <typename CharT>
-        bool basic_custom_locale_ref<CharT>::is_space(code_point cp) const
-        {
-            return std::isspace(static_cast<wchar_t>(cp), to_locale(*this));
-        }
-        template <typename CharT>
-        bool basic_custom_locale_ref<CharT>::is_digit(code_point cp) const
-        {
-            return std::isdigit(static_cast<wchar_t>(cp), to_locale(*this));
+            return is_ctype(ctype_digit, ch);
         }
 
-        // For some reason, there's no isblank in libc++
         template <typename CharT>
-        bool basic_custom_locale_ref<CharT>::is_blank(char_type ch) const
+        bool basic_custom_locale_ref<CharT>::_is_ctype_wide(
+            uint16_t mask,
+            code_point cp) const
         {
-            return std::use_facet<std::ctype<CharT>>(to_locale(*this))
-                .is(std::ctype_base::blank, ch);
+            const auto* facet =
+                static_cast<locale_data<CharT>*>(m_data)->wide_ctype;
+            SCN_EXPECT(facet);
+            return facet->is(to_std_ctype_mask(mask),
+                             static_cast<wchar_t>(cp));
         }
         template <typename CharT>
-        bool basic_custom_locale_ref<CharT>::is_blank(code_point ch) const
-        {
-            return std::use_facet<std::ctype<wchar_t>>(to_locale(*this))
-                .is(std::ctype_base::blank, static_cast<wchar_t>(ch));
-        }
-        template <typename CharT>
-        bool basic_custom_locale_ref<CharT>::is_blank(
+        bool basic_custom_locale_ref<CharT>::_is_ctype_multibyte(
+            uint16_t mask,
             span<const char_type> ch) const
         {
-            const auto& locale = to_locale(*this);
-            if SCN_CONSTEXPRIF (sizeof(CharT) == 1) {
-                SCN_EXPECT(ch.size() >= 1);
-                code_point cp{};
-                auto it = parse_code_point(ch.begin(), ch.end(), cp);
-                SCN_EXPECT(it);
-                return is_blank(cp);
-            }
-            SCN_EXPECT(ch.size() == 1);
-            return std::use_facet<std::ctype<CharT>>(locale).is(
-                std::ctype_base::blank, ch[0]);
+            SCN_EXPECT(ch.size() >= 1);
+            code_point cp{};
+            auto it = parse_code_point(ch.begin(), ch.end(), cp);
+            SCN_EXPECT(it);
+            return is_ctype(mask, cp);
         }
 
         template <typename T>
@@ -21,6 +21,7 @@
 
 #include <scn/detail/args.h>
 #include <scn/reader/float.h>
+#include <scn/util/stats.h>
 
 #include <cerrno>
 #include <clocale>
@@ -82,6 +83,7 @@ namespace scn {
                              size_t& chars,
                              uint8_t options)
             {
+                SCN_STATS_ADD(float_strtod, 1);
 #if !SCN_DISABLE_LOCALE
                 // Get current C locale
                 const auto loc = std::setlocale(LC_NUMERIC, nullptr);
@@ -217,6 +219,8 @@ namespace scn {
                                        size_t& chars,
                                        uint8_t options)
                 {
+                    SCN_STATS_ADD(float_from_chars, 1);
+                    const auto start = str;
                     const auto len = std::strlen(str);
                     std::chars_format flags{};
                     if (((options & detail::float_scanner<T>::allow_hex) !=
@@ -258,7 +262,7 @@ namespace scn {
                                      "from_chars parsed an out-of-range float");
 #endif
                     }
-                    chars = static_cast<size_t>(result.ptr - str);
+                    chars = static_cast<size_t>(result.ptr - start);
                     return value;
                 }
             };
@@ -339,6 +343,35 @@ namespace scn {
                 return value;
             }
 
+            // Without a null terminator, and without the fallbacks to
+            // from_chars and strtod
+            template <typename T>
+            expected<T> impl_unchecked(const char* first,
+                                       const char* last,
+                                       size_t& chars)
+            {
+                T value{};
+                const auto result =
+                    ::fast_float::from_chars(first, last, value);
+                if (result.ec != std::errc{}) {
+                    return error(error::invalid_scanned_value,
+                                 "fast_float failed to parse float");
+                }
+                if (result.ptr != last &&
+                    (*result.ptr == 'x' || *result.ptr == 'X')) {
+                    return error(error::invalid_scanned_value,
+                                 "fast_float doesn't support hexfloats");
+                }
+                if (std::isinf(value) && *first != 'i' && *first != 'I' &&
+                    !(*first == '-' && last - first > 1 &&
+                      (first[1] == 'i' || first[1] == 'I'))) {
+                    return error(error::value_out_of_range,
+                                 "fast_float failed to parse a large float");
+                }
+                chars = static_cast<size_t>(result.ptr - first);
+                return value;
+            }
+
             template <typename T>
             struct read;
 
@@ -407,6 +440,32 @@ namespace scn {
                                                                options);
             }
         };
+
+        template <typename CharT, typename T>
+        struct read_unchecked {
+            static expected<T> get(span<const CharT>, size_t&)
+            {
+                // wchar_t and long double: no fast path
+                return error(error::invalid_operation,
+                             "No unchecked float parser");
+            }
+        };
+        template <>
+        struct read_unchecked<char, float> {
+            static expected<float> get(span<const char> s, size_t& chars)
+            {
+                return fast_float::impl_unchecked<float>(s.begin(), s.end(),
+                                                         chars);
+            }
+        };
+        template <>
+        struct read_unchecked<char, double> {
+            static expected<double> get(span<const char> s, size_t& chars)
+            {
+                return fast_float::impl_unchecked<double>(s.begin(), s.end(),
+                                                          chars);
+            }
+        };
     }  // namespace read_float
 
     namespace detail {
@@ -430,6 +489,15 @@ namespace scn {
                                                    locale_decimal_point);
         }
 
+        template <typename T>
+        template <typename CharT>
+        expected<T> float_scanner<T>::_read_float_unchecked(
+            span<const CharT> s,
+            size_t& chars)
+        {
+            return read_float::read_unchecked<CharT, T>::get(s, chars);
+        }
+
 #if SCN_INCLUDE_SOURCE_DEFINITIONS
 
         template expected<float>
@@ -452,6 +520,26 @@ namespace scn {
         float_scanner<long double>::_read_float_impl(const wchar_t*,
                                                      size_t&,
                                                      wchar_t);
+
+        template expected<float> float_scanner<float>::_read_float_unchecked(
+            span<const char>,
+            size_t&);
+        template expected<double>
+        float_scanner<double>::_read_float_unchecked(span<const char>,
+                                                     size_t&);
+        template expected<long double>
+        float_scanner<long double>::_read_float_unchecked(span<const char>,
+                                                          size_t&);
+        template expected<float> float_scanner<float>::_read_float_unchecked(
+            span<const wchar_t>,
+            size_t&);
+        template expected<double>
+        float_scanner<double>::_read_float_unchecked(span<const wchar_t>,
+                                                     size_t&);
+        template expected<long double>
+        float_scanner<long double>::_read_float_unchecked(
+            span<const wchar_t>,
+            size_t&);
 #endif
     }  // namespace detail
 
@@ -21,6 +21,9 @@
 
 #include <scn/detail/args.h>
 #include <scn/reader/int.h>
+#include <scn/util/swar.h>
+
+#include <cstring>
 
 namespace scn {
     SCN_BEGIN_NAMESPACE
@@ -68,6 +71,156 @@ namespace scn {
             SCN_GCC_POP
         }
 
+        // Kernels for bases 2, 8 and 16.
+        // Every digit is `shift` bits wide, so the value overflows exactly
+        // when a set bit would be shifted out: no division or multiplication
+        // is needed. For narrow characters, eight digits at a time are
+        // validated and combined in a 64-bit word (SWAR).
+
+        // Parses 8 digits in base `1 << Shift` (2, 8 or 16) from `p` into
+        // `out`. Returns `false` if any of them isn't a valid digit.
+        template <unsigned Shift>
+        SCN_NODISCARD static bool _swar_parse_digits(const char* p,
+                                                     std::uint32_t& out)
+        {
+            constexpr unsigned shift = Shift;
+            const auto w = swar_load(p);
+            if ((w & swar_high) != 0) {
+                return false;
+            }
+
+            std::uint64_t v = w & (swar_ones * 0x0fu);
+            if (shift == 4) {
+                const auto digit = swar_between(w, '0', '9');
+                const auto alpha =
+                    swar_between(w | (swar_ones * 0x20u), 'a', 'f');
+                if ((digit | alpha) != swar_high) {
+                    return false;
+                }
+                v += (alpha >> 7u) * 9u;
+            }
+            else if (swar_between(w, '0', '0' + (1u << shift) - 1) !=
+                     swar_high) {
+                return false;
+            }
+
+            // Combine adjacent digits, first digit most significant
+            v = ((v << shift) | (v >> 8u)) & 0x00ff00ff00ff00ffull;
+            v = ((v << (2 * shift)) | (v >> 16u)) & 0x0000ffff0000ffffull;
+            v = ((v << (4 * shift)) | (v >> 32u)) & 0xffffffffull;
+            out = static_cast<std::uint32_t>(v);
+            return true;
+        }
+
+        // Appends a chunk of eight digits to `tmp`, if it fits
+        template <unsigned Shift, typename UType>
+        static bool _append_pow2_chunk(UType& tmp,
+                                       std::uint32_t chunk,
+                                       std::true_type)
+        {
+            constexpr unsigned bits = std::numeric_limits<UType>::digits;
+            constexpr unsigned chunk_bits = 8 * Shift;
+            if ((tmp >> (bits - chunk_bits)) != 0) {
+                return false;
+            }
+            tmp = static_cast<UType>((tmp << chunk_bits) | chunk);
+            return true;
+        }
+        // UType is exactly as wide as a chunk: only leading zeros can precede
+        // it
+        template <unsigned Shift, typename UType>
+        static bool _append_pow2_chunk(UType& tmp,
+                                       std::uint32_t chunk,
+                                       std::false_type)
+        {
+            if (tmp != 0) {
+                return false;
+            }
+            tmp = static_cast<UType>(chunk);
+            return true;
+        }
+
+        template <unsigned Shift, typename UType>
+        static void _parse_pow2_chunks(const char*& it,
+                                       const char* end,
+                                       UType& tmp)
+        {
+            constexpr unsigned bits = std::numeric_limits<UType>::digits;
+            constexpr unsigned chunk_bits = 8 * Shift;
+            std::uint32_t chunk{};
+            // On overflow, the rest is left for the caller to report
+            while (chunk_bits <= bits && end - it >= 8 &&
+                   _swar_parse_digits<Shift>(it, chunk) &&
+                   _append_pow2_chunk<Shift>(
+                       tmp, chunk,
+                       std::integral_constant<bool, (chunk_bits < bits)>{})) {
+                it += 8;
+            }
+        }
+        template <unsigned Shift, typename UType>
+        static void _parse_pow2_chunks(const wchar_t*&, const wchar_t*, UType&)
+        {
+        }
+
+        template <unsigned Shift, typename T, typename CharT>
+        static expected<typename span<const CharT>::iterator>
+        _parse_int_pow2(T& val, bool minus_sign, span<const CharT> buf)
+        {
+            constexpr unsigned shift = Shift;
+            using utype = typename std::make_unsigned<T>::type;
+            constexpr unsigned bits = std::numeric_limits<utype>::digits;
+            constexpr auto uint_max = static_cast<utype>(-1);
+            constexpr auto int_max = static_cast<utype>(uint_max >> 1);
+            constexpr auto abs_int_min = static_cast<utype>(int_max + 1);
+
+            const auto ubase = 1u << shift;
+            auto it = buf.begin();
+            const auto end = buf.end();
+            utype tmp = 0;
+
+            bool overflow = false;
+            _parse_pow2_chunks<Shift>(it, end, tmp);
+            for (; it != end; ++it) {
+                const auto digit = _char_to_int(*it);
+                if (digit >= ubase) {
+                    break;
+                }
+                if (SCN_UNLIKELY((tmp >> (bits - shift)) != 0)) {
+                    overflow = true;
+                    break;
+                }
+                tmp = static_cast<utype>((tmp << shift) | digit);
+            }
+
+            SCN_MSVC_PUSH
+            SCN_MSVC_IGNORE(4127)  // conditional expression is constant
+            SCN_MSVC_IGNORE(4146)  // result still unsigned
+            const auto limit = std::is_signed<T>::value
+                                   ? (minus_sign ? abs_int_min : int_max)
+                                   : uint_max;
+            if (SCN_UNLIKELY(overflow || tmp > limit)) {
+                if (!minus_sign) {
+                    return error(error::value_out_of_range,
+                                 "Out of range: integer overflow");
+                }
+                return error(error::value_out_of_range,
+                             "Out of range: integer underflow");
+            }
+            if (minus_sign) {
+                if (SCN_UNLIKELY(tmp == abs_int_min)) {
+                    val = std::numeric_limits<T>::min();
+                }
+                else {
+                    val = static_cast<T>(-static_cast<T>(tmp));
+                }
+            }
+            else {
+                val = static_cast<T>(tmp);
+            }
+            SCN_MSVC_POP
+            return it;
+        }
+
         template <typename T>
         template <typename CharT>
         expected<typename span<const CharT>::iterator>
@@ -277,6 +430,17 @@ namespace scn {
 
             using utype = typename std::make_unsigned<T>::type;
 
+            switch (base) {
+                case 2:
+                    return _parse_int_pow2<1>(val, minus_sign, buf);
+                case 8:
+                    return _parse_int_pow2<3>(val, minus_sign, buf);
+                case 16:
+                    return _parse_int_pow2<4>(val, minus_sign, buf);
+                default:
+                    break;
+            }
+
             const auto ubase = static_cast<utype>(base);
             SCN_ASSUME(ubase > 0);
 
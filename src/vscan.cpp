@@ -58,6 +58,24 @@ namespace scn {
             SCN_MOVE(range), SCN_MOVE(loc), fmt, SCN_MOVE(args));         \
     }                                                                     \
                                                                           \
+    vscan_result<detail::vscan_macro::WrappedAlias> vscan_unchecked(      \
+        detail::vscan_macro::WrappedAlias&& range,                        \
+        basic_string_view<detail::vscan_macro::CharAlias> fmt,            \
+        basic_args<detail::vscan_macro::CharAlias>&& args)                \
+    {                                                                     \
+        return detail::vscan_boilerplate(SCN_MOVE(range), fmt,            \
+                                         SCN_MOVE(args), true);           \
+    }                                                                     \
+                                                                          \
+    vscan_result<detail::vscan_macro::WrappedAlias>                       \
+    vscan_default_unchecked(                                              \
+        detail::vscan_macro::WrappedAlias&& range, int n_args,            \
+        basic_args<detail::vscan_macro::CharAlias>&& args)                \
+    {                                                                     \
+        return detail::vscan_boilerplate_default(SCN_MOVE(range), n_args, \
+                                                 SCN_MOVE(args), true);   \
+    }                                                                     \
+                                                                          \
     error vscan_usertype(                                                 \
         basic_context<detail::vscan_macro::WrappedAlias>& ctx,            \
         basic_string_view<detail::vscan_macro::CharAlias> f,              \
@@ -73,6 +91,12 @@ namespace scn {
     SCN_VSCAN_DEFINE(std::wstring, wstring_wrapped, wstring_char)
     SCN_VSCAN_DEFINE(file&, file_ref_wrapped, file_ref_char)
     SCN_VSCAN_DEFINE(wfile&, wfile_ref_wrapped, wfile_ref_char)
+    SCN_VSCAN_DEFINE(segmented_range&,
+                     segmented_range_ref_wrapped,
+                     segmented_range_ref_char)
+    SCN_VSCAN_DEFINE(wsegmented_range&,
+                     wsegmented_range_ref_wrapped,
+                     wsegmented_range_ref_char)
 
 #endif
 
@@ -110,4 +110,87 @@ TEST_CASE_TEMPLATE("boolean", CharT, char, wchar_t)
         CHECK(!b);
         CHECK(e);
     }
+    {
+        bool a{}, b{};
+        auto e = do_scan<CharT>("yes no", "{:y} {:y}", a, b);
+        CHECK(e);
+        CHECK(a);
+        CHECK(!b);
+    }
+    {
+        bool b{};
+        auto e = do_scan<CharT>("true", "{:y}", b);
+        CHECK(!e);
+        CHECK(e.error() == scn::error::invalid_scanned_value);
+    }
+    {
+        bool a{}, b{};
+        auto e = do_scan<CharT>("t f", "{:t} {:t}", a, b);
+        CHECK(e);
+        CHECK(a);
+        CHECK(!b);
+    }
+    {
+        bool b{true};
+        auto e = do_scan<CharT>("fish", "{:t}", b);
+        CHECK(!e);
+        CHECK(e.error() == scn::error::invalid_scanned_value);
+        CHECK(b);
+
+        // only "t" and "f" need to be whole words
+        b = false;
+        e = do_scan<CharT>("trueish", "{:st}", b);
+        CHECK(e);
+        CHECK(b);
+
+        e = do_scan<CharT>("f", "{:st}", b);
+        CHECK(e);
+        CHECK(!b);
+
+        bool a{};
+        e = do_scan<CharT>("trueish", "{:s}", a);
+        CHECK(e);
+        CHECK(a);
+    }
+    {
+        bool a{}, b{}, c{true};
+        auto e = do_scan<CharT>("false yes 0", "{:sty} {:sty} {:sti}", a, b, c);
+        CHECK(e);
+        CHECK(!a);
+        CHECK(b);
+        CHECK(!c);
+    }
+}
+
+TEST_CASE_TEMPLATE("boolean non-contiguous", CharT, char, wchar_t)
+{
+    {
+        auto src = get_deque<CharT>(widen<CharT>("true false 1 nope"));
+        bool a{}, b{true}, c{};
+        auto ret = scn::scan(src, widen<CharT>("{} {} {}").c_str(), a, b, c);
+        CHECK(ret);
+        CHECK(a);
+        CHECK(!b);
+        CHECK(c);
+
+        bool d{};
+        ret = scn::scan(ret.range(), widen<CharT>("{}").c_str(), d);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+    }
+    {
+        auto src = get_deque<CharT>(widen<CharT>("fish"));
+        bool b{true};
+        auto ret = scn::scan(src, widen<CharT>("{:t}").c_str(), b);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+        CHECK(b);
+    }
+    {
+        auto src = get_deque<CharT>(widen<CharT>("no"));
+        bool b{true};
+        auto ret = scn::scan(src, widen<CharT>("{:y}").c_str(), b);
+        CHECK(ret);
+        CHECK(!b);
+    }
 }
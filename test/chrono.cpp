@@ -0,0 +1,186 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <scn/chrono.h>
+
+#include "test.h"
+
+using sys_seconds =
+    std::chrono::time_point<std::chrono::system_clock, std::chrono::seconds>;
+using sys_ms = std::chrono::time_point<std::chrono::system_clock,
+                                       std::chrono::milliseconds>;
+
+static long long to_seconds(sys_seconds t)
+{
+    return static_cast<long long>(t.time_since_epoch().count());
+}
+
+TEST_CASE("tm iso 8601")
+{
+    std::tm t{};
+    std::string rest;
+    auto ret = scn::scan("2021-03-04T05:06:07Z next", "{} {}", t, rest);
+    CHECK(ret);
+    CHECK(t.tm_year == 121);
+    CHECK(t.tm_mon == 2);
+    CHECK(t.tm_mday == 4);
+    CHECK(t.tm_hour == 5);
+    CHECK(t.tm_min == 6);
+    CHECK(t.tm_sec == 7);
+    CHECK(t.tm_wday == 4);
+    CHECK(t.tm_yday == 62);
+    CHECK(rest == "next");
+
+    ret = scn::scan_default("2020-12-31 next", t);
+    CHECK(ret);
+    CHECK(t.tm_yday == 365);
+    CHECK(t.tm_hour == 0);
+    CHECK(ret.range_as_string() == " next");
+
+    ret = scn::scan_default("2021-02-29", t);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::value_out_of_range);
+
+    ret = scn::scan_default("2021-0x-01", t);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+
+    ret = scn::scan_default("", t);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::end_of_range);
+}
+
+TEST_CASE("sys_time iso 8601")
+{
+    sys_seconds t{};
+    auto ret = scn::scan_default("1970-01-02T00:00:01Z", t);
+    CHECK(ret);
+    CHECK(to_seconds(t) == 86401);
+
+    ret = scn::scan_default("2000-03-01 12:00:00+01:30", t);
+    CHECK(ret);
+    CHECK(to_seconds(t) == 951912000 - 5400);
+
+    ret = scn::scan_default("1969-12-31t23:59", t);
+    CHECK(ret);
+    CHECK(to_seconds(t) == -60);
+
+    sys_ms ms{};
+    ret = scn::scan_default("2021-03-04T05:06:07.25-00:00", ms);
+    CHECK(ret);
+    CHECK(ms.time_since_epoch().count() == 1614834367250);
+
+    // a fraction is only read after seconds
+    ret = scn::scan_default("2021-03-04T05:06.5Z", ms);
+    CHECK(ret);
+    CHECK(ms.time_since_epoch().count() == 1614834360000);
+    CHECK(ret.range_as_string() == ".5Z");
+}
+
+TEST_CASE("time format string")
+{
+    std::tm t{};
+    auto ret = scn::scan("Thu, 04 Mar 2021 5:06:07 PM",
+                         "{:%a, %d %b %Y %I:%M:%S %p}", t);
+    CHECK(ret);
+    CHECK(t.tm_mon == 2);
+    CHECK(t.tm_mday == 4);
+    CHECK(t.tm_hour == 17);
+
+    ret = scn::scan("12/31/99 23:59", "{:%D %R}", t);
+    CHECK(ret);
+    CHECK(t.tm_year == 99);
+    CHECK(t.tm_mon == 11);
+    CHECK(t.tm_min == 59);
+
+    ret = scn::scan("2024/060", "{:%Y/%j}", t);
+    CHECK(ret);
+    CHECK(t.tm_mon == 1);
+    CHECK(t.tm_mday == 29);
+
+    sys_seconds s{};
+    ret = scn::scan("[1970-01-01 01:00:00 +0100] 100%", "[{:%F %T %z}] 100%",
+                    s);
+    CHECK(ret);
+    CHECK(to_seconds(s) == 0);
+
+    ret = scn::scan("2021-03-04", "{:%Y-%m-%d %H}", t);
+    CHECK(!ret);
+
+    ret = scn::scan("2021", "{:%Q}", t);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_format_string);
+    ret = scn::scan("2021", "{:%}", t);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_format_string);
+}
+
+TEST_CASE("time non-contiguous")
+{
+    std::tm t{};
+    auto src = get_deque<char>("2021-03-04 05:06:07.5+02:00 foo");
+    auto ret = scn::scan_default(src, t);
+    CHECK(ret);
+    CHECK(t.tm_hour == 5);
+    CHECK(t.tm_sec == 7);
+
+    src = get_deque<char>("04.03.2021 x");
+    ret = scn::scan(src, "{:%d.%m.%Y}", t);
+    CHECK(ret);
+    CHECK(t.tm_mday == 4);
+    CHECK(t.tm_year == 121);
+}
+
+TEST_CASE("time wide")
+{
+    sys_seconds t{};
+    auto ret = scn::scan_default(L"1970-01-01T00:01:00Z", t);
+    CHECK(ret);
+    CHECK(to_seconds(t) == 60);
+
+    std::tm tm{};
+    ret = scn::scan(L"jan 2 1970", L"{:%b %e %Y}", tm);
+    CHECK(ret);
+    CHECK(tm.tm_mday == 2);
+}
+
+TEST_CASE("duration")
+{
+    std::chrono::milliseconds ms{};
+    auto ret = scn::scan_default("150ms", ms);
+    CHECK(ret);
+    CHECK(ms.count() == 150);
+
+    ret = scn::scan_default("20 ms", ms);
+    CHECK(ret);
+    CHECK(ms.count() == 20);
+    CHECK(ret.range_as_string() == " ms");
+
+    ret = scn::scan_default("3s", ms);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+
+    std::chrono::duration<double> secs{};
+    ret = scn::scan_default("1.5s", secs);
+    CHECK(ret);
+    CHECK(secs.count() == doctest::Approx(1.5));
+
+    ret = scn::scan("01:02:03.5", "{:%T}", ms);
+    CHECK(ret);
+    CHECK(ms.count() == 3723500);
+}
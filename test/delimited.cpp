@@ -0,0 +1,237 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "test.h"
+
+template <typename CharT>
+static std::vector<std::basic_string<CharT>> read_fields(
+    scn::basic_delimited_tokenizer<CharT>& tok,
+    std::vector<bool>* eor = nullptr)
+{
+    std::vector<std::basic_string<CharT>> ret;
+    while (!tok.at_end()) {
+        auto f = tok.next_field();
+        REQUIRE(f);
+        ret.emplace_back();
+        tok.unescape(f.value(), ret.back());
+        if (eor) {
+            eor->push_back(f.value().end_of_record);
+        }
+    }
+    return ret;
+}
+
+TEST_CASE_TEMPLATE("delimited fields", CharT, char, wchar_t)
+{
+    using string_type = std::basic_string<CharT>;
+
+    SUBCASE("csv")
+    {
+        string_type source = widen<CharT>("a,b,c\n1,,3\n");
+        auto tok = scn::delimited(source, scn::csv_options<CharT>());
+        std::vector<bool> eor;
+        auto fields = read_fields(tok, &eor);
+        REQUIRE(fields.size() == 6);
+        CHECK(fields[0] == widen<CharT>("a"));
+        CHECK(fields[2] == widen<CharT>("c"));
+        CHECK(fields[4].empty());
+        CHECK(fields[5] == widen<CharT>("3"));
+        CHECK(eor == std::vector<bool>{false, false, true, false, false, true});
+    }
+    SUBCASE("no trailing newline, trailing delimiter")
+    {
+        string_type source = widen<CharT>("a,\nb");
+        auto tok = scn::delimited(source, scn::csv_options<CharT>());
+        std::vector<bool> eor;
+        auto fields = read_fields(tok, &eor);
+        REQUIRE(fields.size() == 3);
+        CHECK(fields[1].empty());
+        CHECK(fields[2] == widen<CharT>("b"));
+        CHECK(eor == std::vector<bool>{false, true, true});
+    }
+    SUBCASE("quoted")
+    {
+        string_type source =
+            widen<CharT>("\"a,b\",\"say \"\"hi\"\"\",\"multi\nline\"\r\nx");
+        auto tok = scn::delimited(source, scn::csv_options<CharT>());
+
+        auto f = tok.next_field();
+        REQUIRE(f);
+        CHECK(f.value().quoted);
+        CHECK(!f.value().escaped);
+        CHECK(string_type{f.value().value.data(), f.value().value.size()} ==
+              widen<CharT>("a,b"));
+
+        f = tok.next_field();
+        REQUIRE(f);
+        CHECK(f.value().escaped);
+        string_type s;
+        tok.unescape(f.value(), s);
+        CHECK(s == widen<CharT>("say \"hi\""));
+
+        f = tok.next_field();
+        REQUIRE(f);
+        CHECK(f.value().end_of_record);
+        tok.unescape(f.value(), s);
+        CHECK(s == widen<CharT>("multi\nline"));
+
+        f = tok.next_field();
+        REQUIRE(f);
+        tok.unescape(f.value(), s);
+        CHECK(s == widen<CharT>("x"));
+        CHECK(tok.at_end());
+
+        f = tok.next_field();
+        CHECK(!f);
+        CHECK(f.error().code() == scn::error::end_of_range);
+    }
+    SUBCASE("escape")
+    {
+        string_type source = widen<CharT>("\"a\\\"b\",c");
+        auto opt = scn::csv_options<CharT>();
+        opt.escape = scn::detail::ascii_widen<CharT>('\\');
+        auto tok = scn::delimited(source, opt);
+        auto fields = read_fields(tok);
+        REQUIRE(fields.size() == 2);
+        CHECK(fields[0] == widen<CharT>("a\"b"));
+        CHECK(fields[1] == widen<CharT>("c"));
+    }
+    SUBCASE("malformed")
+    {
+        string_type source = widen<CharT>("\"abc");
+        auto tok = scn::delimited(source, scn::csv_options<CharT>());
+        auto f = tok.next_field();
+        CHECK(!f);
+        CHECK(f.error().code() == scn::error::invalid_scanned_value);
+
+        CHECK(tok.at_end());
+
+        // the rest of the record is skipped
+        source = widen<CharT>("\"abc\"d,e\nf");
+        tok = scn::delimited(source, scn::csv_options<CharT>());
+        f = tok.next_field();
+        CHECK(!f);
+        CHECK(f.error().code() == scn::error::invalid_scanned_value);
+        auto fields = read_fields(tok);
+        REQUIRE(fields.size() == 1);
+        CHECK(fields[0] == widen<CharT>("f"));
+    }
+    SUBCASE("tsv")
+    {
+        string_type source = widen<CharT>("a\t\"b\"\r\nc\td\r\n");
+        auto tok = scn::delimited(source, scn::tsv_options<CharT>());
+        auto fields = read_fields(tok);
+        REQUIRE(fields.size() == 4);
+        CHECK(fields[1] == widen<CharT>("\"b\""));
+        CHECK(fields[3] == widen<CharT>("d"));
+    }
+}
+
+TEST_CASE("delimited records")
+{
+    auto tok = scn::delimited("id,name,score\n"
+                              "1,\"Doe, J\",4.5\n"
+                              "2, Smith ,-1e3\n"
+                              "x,y,z\n"
+                              "3,short\n"
+                              "4,long,5,extra\n");
+    CHECK(tok.skip_record());
+
+    int id{};
+    std::string name;
+    double score{};
+    auto e = tok.read_record(id, name, score);
+    CHECK(e);
+    CHECK(id == 1);
+    CHECK(name == "Doe, J");
+    CHECK(score == doctest::Approx(4.5));
+
+    scn::string_view sv;
+    e = tok.read_record(id, sv, score);
+    CHECK(e);
+    CHECK(id == 2);
+    CHECK(std::string{sv.data(), sv.size()} == " Smith ");
+    CHECK(score == doctest::Approx(-1e3));
+
+    e = tok.read_record(id, name, score);
+    CHECK(!e);
+    CHECK(e.code() == scn::error::invalid_scanned_value);
+
+    e = tok.read_record(id, name, score);
+    CHECK(!e);
+    CHECK(e.code() == scn::error::invalid_scanned_value);
+    CHECK(id == 3);
+
+    e = tok.read_record(id, name, score);
+    CHECK(e);
+    CHECK(id == 4);
+    CHECK(score == doctest::Approx(5.0));
+    CHECK(tok.at_end());
+}
+
+TEST_CASE("delimited record errors")
+{
+    auto tok = scn::delimited("1,x,3\nx,\"unterminated\n");
+    int a{}, b{}, c{};
+    auto e = tok.read_record(a, b, c);
+    CHECK(!e);
+    CHECK(e.code() == scn::error::invalid_scanned_value);
+    CHECK(a == 1);
+
+    e = tok.read_record(a, b);
+    CHECK(!e);
+    CHECK(e.code() == scn::error::invalid_scanned_value);
+    CHECK(std::string{e.msg()} == "Unterminated quoted field");
+    CHECK(tok.at_end());
+}
+
+TEST_CASE("delimited malformed record loop")
+{
+    auto tok = scn::delimited("1,\"Doe\n2,x\n");
+    int id{};
+    std::string name;
+    int errors = 0, records = 0;
+    while (!tok.at_end()) {
+        auto e = tok.read_record(id, name);
+        if (!e) {
+            CHECK(e.code() == scn::error::invalid_scanned_value);
+            ++errors;
+            REQUIRE(errors < 10);
+            continue;
+        }
+        ++records;
+    }
+    CHECK(errors == 1);
+    CHECK(records == 1);
+    CHECK(id == 2);
+    CHECK(name == "x");
+}
+
+TEST_CASE("delimited empty field")
+{
+    auto tok = scn::delimited("1,,3\n1, ,3\n");
+    int a{}, b{}, c{};
+    auto e = tok.read_record(a, b, c);
+    CHECK(!e);
+    CHECK(e.code() == scn::error::invalid_scanned_value);
+
+    e = tok.read_record(a, b, c);
+    CHECK(!e);
+    CHECK(e.code() == scn::error::invalid_scanned_value);
+    CHECK(tok.at_end());
+}
@@ -0,0 +1,208 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "test.h"
+
+namespace describe_test {
+    struct point {
+        int x;
+        int y;
+    };
+    SCN_DESCRIBE(point, x, y)
+
+    struct record {
+        int id;
+        std::string name;
+        point pos;
+        double score;
+    };
+    SCN_DESCRIBE(record, id, name, pos, score)
+
+    struct bracketed {
+        int x;
+        int y;
+    };
+    SCN_DESCRIBE(bracketed, x, y)
+    SCN_DESCRIBE_FORMAT(bracketed, "[{}, {:x}]")
+
+    struct bad_format {
+        int x;
+        int y;
+    };
+    SCN_DESCRIBE(bad_format, x, y)
+    SCN_DESCRIBE_FORMAT(bad_format, "[{}]")
+
+    struct undescribed {
+        int x;
+    };
+
+    struct counted {
+        int value;
+    };
+    struct counted_pair {
+        counted a;
+        counted b;
+    };
+    SCN_DESCRIBE(counted_pair, a, b)
+
+    int counted_scanner_copies = 0;
+}  // namespace describe_test
+
+namespace scn {
+    // Scans without modifying itself, so a described type doesn't need to
+    // copy it
+    template <>
+    struct scanner<describe_test::counted> : empty_parser {
+        scanner() = default;
+        scanner(const scanner&)
+        {
+            ++describe_test::counted_scanner_copies;
+        }
+        scanner& operator=(const scanner&)
+        {
+            ++describe_test::counted_scanner_copies;
+            return *this;
+        }
+
+        template <typename Context>
+        error scan(describe_test::counted& val, Context& ctx) const
+        {
+            return scan_usertype(ctx, "{}", val.value);
+        }
+    };
+}  // namespace scn
+
+static_assert(scn::detail::is_described<describe_test::point>::value, "");
+static_assert(!scn::detail::is_described<describe_test::undescribed>::value,
+              "");
+static_assert(!scn::detail::is_described<int>::value, "");
+
+TEST_CASE("describe scan_default")
+{
+    describe_test::record r{};
+    auto ret = scn::scan_default("1 foo 2 3 4.5 rest", r);
+    CHECK(ret);
+    CHECK(ret.range_as_string() == " rest");
+    CHECK(r.id == 1);
+    CHECK(r.name == "foo");
+    CHECK(r.pos.x == 2);
+    CHECK(r.pos.y == 3);
+    CHECK(r.score == doctest::Approx(4.5));
+}
+
+TEST_CASE("describe scan")
+{
+    describe_test::point a{}, b{};
+    auto ret = scn::scan("(1 2), (3 4)", "({}), ({})", a, b);
+    CHECK(ret);
+    CHECK(a.x == 1);
+    CHECK(a.y == 2);
+    CHECK(b.x == 3);
+    CHECK(b.y == 4);
+}
+
+TEST_CASE("describe error")
+{
+    describe_test::point p{};
+    auto ret = scn::scan_default("1 foo", p);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+    CHECK(p.x == 0);
+    CHECK(p.y == 0);
+
+    ret = scn::scan_default("1", p);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::end_of_range);
+}
+
+TEST_CASE("describe scan_list")
+{
+    std::vector<describe_test::point> points;
+    auto ret = scn::scan_list("1 2\n3 4\n5 6\n", points);
+    CHECK(ret);
+    REQUIRE(points.size() == 3);
+    CHECK(points[0].x == 1);
+    CHECK(points[1].y == 4);
+    CHECK(points[2].x == 5);
+    CHECK(points[2].y == 6);
+}
+
+TEST_CASE("describe non-contiguous source")
+{
+    describe_test::record r{};
+    auto src = get_deque<char>("1 foo 2 3 4.5");
+    auto ret = scn::scan_default(src, r);
+    CHECK(ret);
+    CHECK(r.id == 1);
+    CHECK(r.name == "foo");
+    CHECK(r.pos.y == 3);
+    CHECK(r.score == doctest::Approx(4.5));
+}
+
+TEST_CASE("describe format")
+{
+    describe_test::bracketed b{};
+    auto ret = scn::scan_default("[1,  ff] rest", b);
+    CHECK(ret);
+    CHECK(ret.range_as_string() == " rest");
+    CHECK(b.x == 1);
+    CHECK(b.y == 0xff);
+
+    ret = scn::scan_default("[2 3]", b);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+    CHECK(b.x == 1);
+
+    std::vector<describe_test::bracketed> list;
+    ret = scn::scan_list("[1, a] [2, b]", list);
+    CHECK(ret);
+    REQUIRE(list.size() == 2);
+    CHECK(list[1].x == 2);
+    CHECK(list[1].y == 0xb);
+
+    auto src = get_deque<char>("[4, 10]");
+    auto dret = scn::scan_default(src, b);
+    CHECK(dret);
+    CHECK(b.x == 4);
+    CHECK(b.y == 0x10);
+
+    auto wret = scn::scan_default(L"[5, c]", b);
+    CHECK(wret);
+    CHECK(b.x == 5);
+    CHECK(b.y == 0xc);
+
+    describe_test::bad_format f{};
+    ret = scn::scan_default("[1] 2", f);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_format_string);
+}
+
+TEST_CASE("describe const scanner")
+{
+    describe_test::counted_pair p{};
+    auto ret = scn::scan_default("1 2", p);
+    CHECK(ret);
+    CHECK(p.a.value == 1);
+    CHECK(p.b.value == 2);
+
+    describe_test::counted_scanner_copies = 0;
+    ret = scn::scan_default("3 4", p);
+    CHECK(ret);
+    CHECK(p.b.value == 4);
+    CHECK(describe_test::counted_scanner_copies == 0);
+}
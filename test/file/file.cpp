@@ -133,6 +133,87 @@ TEST_CASE_TEMPLATE("file", CharT, char, wchar_t)
         CHECK(word == widen<CharT>("word"));
     }
 
+    SUBCASE("string_view")
+    {
+        scn::basic_string_view<CharT> first, second, third;
+        auto result = scn::scan_default(file, first, second, third);
+        CHECK(result);
+        CHECK(string_type{first.data(), first.size()} == widen<CharT>("123"));
+        CHECK(string_type{second.data(), second.size()} ==
+              widen<CharT>("word"));
+        CHECK(string_type{third.data(), third.size()} ==
+              widen<CharT>("another"));
+
+        result = scn::scan_default(result.range(), first);
+        CHECK(!result);
+        CHECK(result.error().code() == scn::error::end_of_range);
+        CHECK(string_type{first.data(), first.size()} == widen<CharT>("123"));
+
+        file.release_pinned();
+    }
+
+    SUBCASE("ignore_until")
+    {
+        auto result = scn::ignore_until(file, CharT{0x61});  // 'a'
+        CHECK(result);
+
+        string_type word;
+        result = scn::scan_default(result.range(), word);
+        CHECK(result);
+        CHECK(word == widen<CharT>("another"));
+    }
+    SUBCASE("ignore_until_n")
+    {
+        auto result = scn::ignore_until_n(file, 2, CharT{0x0a});
+        CHECK(result);
+
+        int i;
+        result = scn::scan_default(result.range(), i);
+        CHECK(result);
+        CHECK(i == 3);
+    }
+    SUBCASE("discard_until with a rollback point")
+    {
+        auto wrapped = scn::wrap(file);
+        for (int i = 0; i < 2; ++i) {  // "12"
+            REQUIRE(wrapped.begin() != wrapped.end());
+            wrapped.advance();
+        }
+        auto e = wrapped.discard_until(CharT{0x61}, 100);  // 'a'
+        CHECK(e);
+        CHECK((*wrapped.begin()).value() == CharT{0x61});
+
+        // "3\nword " was kept, so rolling back over it works
+        CHECK(wrapped.reset_to_rollback_point());
+        string_type str;
+        auto result = scn::scan_default(wrapped, str);
+        CHECK(result);
+        CHECK(str == widen<CharT>("123"));
+        result = scn::scan_default(result.range(), str);
+        CHECK(result);
+        CHECK(str == widen<CharT>("word"));
+    }
+    SUBCASE("discard_until EOF")
+    {
+        auto wrapped = scn::wrap(file);
+        auto e = wrapped.discard_until(CharT{0x78}, 100);  // 'x'
+        CHECK(!e);
+        CHECK(e.code() == scn::error::end_of_range);
+        CHECK(wrapped.begin() == wrapped.end());
+    }
+    SUBCASE("ignore_until EOF")
+    {
+        string_type word;
+        auto result = scn::scan_default(file, word);
+        CHECK(result);
+
+        // the rest of the file is kept for the rollback point,
+        // and skipped over
+        result = scn::ignore_until(result.range(), CharT{0x78});  // 'x'
+        CHECK(result);
+        CHECK(result.empty());
+    }
+
     SUBCASE("getline")
     {
         string_type line;
@@ -149,6 +230,19 @@ TEST_CASE_TEMPLATE("file", CharT, char, wchar_t)
         CHECK(result.error().code() == scn::error::end_of_range);
         CHECK(line == widen<CharT>("word another"));
     }
+
+    SUBCASE("lines")
+    {
+        std::vector<string_type> lines;
+        auto l = scn::lines(file);
+        for (auto line : l) {
+            lines.emplace_back(line.data(), line.size());
+        }
+        CHECK(l.get_error());
+        REQUIRE(lines.size() == 2);
+        CHECK(lines[0] == widen<CharT>("123"));
+        CHECK(lines[1] == widen<CharT>("word another"));
+    }
 }
 
 TEST_CASE("mapped file")
@@ -186,6 +280,16 @@ TEST_CASE("mapped file")
         CHECK(result.error().code() == scn::error::end_of_range);
         CHECK(word == "another");
     }
+    SUBCASE("lines")
+    {
+        std::vector<std::string> lines;
+        for (auto line : scn::lines(file)) {
+            lines.emplace_back(line.data(), line.size());
+        }
+        REQUIRE(lines.size() == 2);
+        CHECK(lines[0] == "123");
+        CHECK(lines[1] == "word another");
+    }
 }
 
 struct int_and_string {
@@ -311,3 +415,63 @@ TEST_CASE("file usertype")
         CHECK(s == "word");
     }
 }
+
+TEST_CASE("file string_view pinned in place")
+{
+    auto f = std::tmpfile();
+    REQUIRE(f);
+    std::vector<std::string> words;
+    for (int i = 0; i < 1000; ++i) {
+        words.push_back("word" + std::to_string(i));
+        std::fputs(words.back().c_str(), f);
+        std::fputc(' ', f);
+    }
+    std::rewind(f);
+
+    scn::owning_file file{f};
+    std::vector<scn::string_view> views;
+    scn::string_view word;
+    auto result = scn::make_result(file);
+    while ((result = scn::scan_default(result.range(), word))) {
+        views.push_back(word);
+    }
+    CHECK(result.error().code() == scn::error::end_of_range);
+
+    // the buffer has been reallocated many times over,
+    // but the views still point to the old buffers
+    REQUIRE(views.size() == words.size());
+    for (size_t i = 0; i < views.size(); ++i) {
+        CHECK(std::string{views[i].data(), views[i].size()} == words[i]);
+    }
+
+    // sync() doesn't overwrite pinned views either
+    file.sync();
+    CHECK(std::string{views[0].data(), views[0].size()} == words[0]);
+    file.release_pinned();
+}
+
+TEST_CASE("file lines across blocks")
+{
+    auto f = std::tmpfile();
+    REQUIRE(f);
+    std::vector<std::string> expected;
+    for (int i = 0; i < 2000; ++i) {
+        // some lines are longer than a block
+        const auto len = static_cast<size_t>(i % 7 == 0 ? 5000 : i % 50);
+        expected.emplace_back(len, static_cast<char>('a' + i % 26));
+        std::fputs(expected.back().c_str(), f);
+        std::fputs(i % 3 == 0 ? "\r\n" : "\n", f);
+    }
+    std::fputs("last", f);
+    expected.emplace_back("last");
+    std::rewind(f);
+
+    scn::owning_file file{f};
+    std::vector<std::string> lines;
+    auto l = scn::lines(file, true);
+    for (auto line : l) {
+        lines.emplace_back(line.data(), line.size());
+    }
+    CHECK(l.get_error());
+    CHECK(lines == expected);
+}
@@ -0,0 +1,160 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "test.h"
+
+TEST_CASE("fixed_width_layout")
+{
+    auto layout = scn::fixed_width_layout{{10, 8}, {0, 10}};
+    CHECK(layout.size() == 2);
+    CHECK(layout[1].offset == 0);
+    CHECK(layout.record_width() == 18);
+
+    layout = scn::fixed_width_layout::from_widths({4, 2, 6});
+    REQUIRE(layout.size() == 3);
+    CHECK(layout[1].offset == 4);
+    CHECK(layout[2].offset == 6);
+    CHECK(layout[2].width == 6);
+    CHECK(layout.record_width() == 12);
+}
+
+TEST_CASE_TEMPLATE("fixed_width fields", CharT, char, wchar_t)
+{
+    using string_type = std::basic_string<CharT>;
+
+    string_type source = widen<CharT>("  42  abc\r\n7   x\n\n");
+    auto reader = scn::fixed_width(
+        source, scn::fixed_width_layout::from_widths({4, 6}));
+
+    auto rec = reader.next_record();
+    REQUIRE(rec);
+    CHECK(rec.value().size() == 9);
+    auto f = reader.field(rec.value(), 0);
+    CHECK(string_type{f.data(), f.size()} == widen<CharT>("42"));
+    f = reader.field(rec.value(), 1);
+    CHECK(string_type{f.data(), f.size()} == widen<CharT>("abc"));
+
+    // short record: truncated column
+    rec = reader.next_record();
+    REQUIRE(rec);
+    f = reader.field(rec.value(), 1);
+    CHECK(string_type{f.data(), f.size()} == widen<CharT>("x"));
+
+    // empty record
+    rec = reader.next_record();
+    REQUIRE(rec);
+    CHECK(rec.value().size() == 0);
+    CHECK(reader.field(rec.value(), 0).size() == 0);
+    CHECK(reader.at_end());
+
+    rec = reader.next_record();
+    CHECK(!rec);
+    CHECK(rec.error().code() == scn::error::end_of_range);
+}
+
+TEST_CASE("fixed_width records")
+{
+    auto reader = scn::fixed_width("0000000001  123.50Doe       \n"
+                                   "2           -1e3  Smith\n"
+                                   "x           0     y\n"
+                                   "3           12x   z\n"
+                                   "4           5\n",
+                                   scn::fixed_width_layout{
+                                       {0, 12}, {12, 6}, {18, 10}});
+    int id{};
+    double amount{};
+    std::string name;
+    auto e = reader.read_record(id, amount, name);
+    CHECK(e);
+    CHECK(id == 1);
+    CHECK(amount == doctest::Approx(123.5));
+    CHECK(name == "Doe");
+
+    scn::string_view sv;
+    e = reader.read_record(id, amount, sv);
+    CHECK(e);
+    CHECK(id == 2);
+    CHECK(amount == doctest::Approx(-1e3));
+    CHECK(std::string{sv.data(), sv.size()} == "Smith");
+
+    e = reader.read_record(id, amount, name);
+    CHECK(!e);
+    CHECK(e.code() == scn::error::invalid_scanned_value);
+
+    e = reader.read_record(id, amount, name);
+    CHECK(!e);
+    CHECK(e.code() == scn::error::invalid_scanned_value);
+    CHECK(id == 3);
+
+    e = reader.read_record(id, amount);
+    CHECK(e);
+    CHECK(id == 4);
+    CHECK(amount == doctest::Approx(5.0));
+    CHECK(reader.at_end());
+
+    e = reader.read_record(id);
+    CHECK(!e);
+    CHECK(e.code() == scn::error::end_of_range);
+}
+
+TEST_CASE("fixed_width blank field")
+{
+    auto reader = scn::fixed_width(
+        "1   \n2\n", scn::fixed_width_layout::from_widths({1, 3}));
+    int a{}, b{};
+    auto e = reader.read_record(a, b);
+    CHECK(!e);
+    CHECK(e.code() == scn::error::invalid_scanned_value);
+
+    e = reader.read_record(a, b);
+    CHECK(!e);
+    CHECK(e.code() == scn::error::invalid_scanned_value);
+    CHECK(a == 2);
+    CHECK(reader.at_end());
+}
+
+TEST_CASE("fixed_width record_length")
+{
+    auto opt = scn::fixed_width_options{};
+    opt.record_length = 6;
+    opt.trim = false;
+    auto reader = scn::fixed_width(
+        "12 abc34 de 5", scn::fixed_width_layout::from_widths({2, 4}), opt);
+
+    int n{};
+    std::string s;
+    int sum = 0;
+    std::vector<std::string> strs;
+    auto e = reader.for_each_record(
+        [&]() {
+            sum += n;
+            strs.push_back(s);
+        },
+        n, s);
+    CHECK(e);
+    CHECK(sum == 12 + 34 + 5);
+    CHECK(strs == std::vector<std::string>{" abc", " de ", ""});
+    CHECK(reader.at_end());
+
+    reader = scn::fixed_width(
+        "12 abc", scn::fixed_width_layout::from_widths({2, 4}), opt);
+    int m{};
+    e = reader.read_record(n, s, m);
+    CHECK(!e);
+    CHECK(e.code() == scn::error::invalid_operation);
+}
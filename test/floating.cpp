@@ -281,6 +281,88 @@ TEST_CASE_TEMPLATE("non-contiguous", CharT, char, wchar_t)
     CHECK(f == doctest::Approx(3.14));
 }
 
+TEST_CASE_TEMPLATE("followed by separator", CharT, char, wchar_t)
+{
+    double a{}, b{}, c{};
+    auto ret = scn::scan(widen<CharT>("1.5,-2e3;nan"),
+                         widen<CharT>("{},{};{}"), a, b, c);
+    CHECK(ret);
+    CHECK(a == doctest::Approx(1.5));
+    CHECK(b == doctest::Approx(-2000.0));
+    CHECK(std::isnan(c));
+
+    auto src = get_deque<CharT>(widen<CharT>("3.25,4"));
+    auto dret = scn::scan(src, widen<CharT>("{},{}"), a, b);
+    CHECK(dret);
+    CHECK(a == doctest::Approx(3.25));
+    CHECK(b == doctest::Approx(4.0));
+}
+
+TEST_CASE("float token stops at punctuation")
+{
+    double d{};
+    auto ret = scn::scan_default("2.5];rest", d);
+    CHECK(ret);
+    CHECK(d == doctest::Approx(2.5));
+    CHECK(ret.range_as_string() == "];rest");
+
+    ret = scn::scan_default("0x1p3,1", d);
+    CHECK(ret);
+    CHECK(d == doctest::Approx(8.0));
+    CHECK(ret.range_as_string() == ",1");
+
+    // letters are still a part of the token
+    ret = scn::scan_default("-inf|", d);
+    CHECK(ret);
+    CHECK(std::isinf(d));
+    CHECK(ret.range_as_string() == "|");
+}
+
+TEST_CASE("comma-separated float list")
+{
+    std::vector<double> values;
+    auto ret = scn::scan_list_ex("1.5,2.5,-3e2,4", values,
+                                 scn::list_separator(','));
+    CHECK(ret);
+    REQUIRE(values.size() == 4);
+    CHECK(values[0] == doctest::Approx(1.5));
+    CHECK(values[1] == doctest::Approx(2.5));
+    CHECK(values[2] == doctest::Approx(-300.0));
+    CHECK(values[3] == doctest::Approx(4.0));
+}
+
+TEST_CASE_TEMPLATE("float unchecked", CharT, char, wchar_t)
+{
+    double d{};
+    float f{};
+    auto ret = scn::scan_unchecked(widen<CharT>("-1.5e3 0.25,x"),
+                                   widen<CharT>("{} {}"), d, f);
+    CHECK(ret);
+    CHECK(d == doctest::Approx(-1500.0));
+    CHECK(f == doctest::Approx(0.25f));
+    CHECK(ret.range_as_string() == widen<CharT>(",x"));
+
+    // the regular scanner handles hexfloats and signs
+    ret = scn::scan_default_unchecked(widen<CharT>("0x1p3 +2"), d, f);
+    CHECK(ret);
+    CHECK(d == doctest::Approx(8.0));
+    CHECK(f == doctest::Approx(2.0f));
+
+    ret = scn::scan_default_unchecked(widen<CharT>("1e999"), d);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::value_out_of_range);
+
+    d = 1.0;
+    ret = scn::scan_default_unchecked(widen<CharT>("abc"), d);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+    CHECK(d == doctest::Approx(1.0));
+
+    ret = scn::scan_default_unchecked(widen<CharT>(""), d);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::end_of_range);
+}
+
 TEST_CASE("float error")
 {
     double d{};
@@ -162,3 +162,80 @@ TEST_CASE("utf8 literal")
         CHECK(b2 == static_cast<char>(0xb6));
     }
 }
+
+TEST_CASE("literal runs")
+{
+    SUBCASE("contiguous")
+    {
+        int a{}, b{};
+        std::string msg{};
+        auto e = scn::scan("time=12 level=3 msg=hello",
+                           "time={} level={} msg={}", a, b, msg);
+        CHECK(e);
+        CHECK(e.empty());
+        CHECK(a == 12);
+        CHECK(b == 3);
+        CHECK(msg == "hello");
+    }
+    SUBCASE("mismatch")
+    {
+        int a{};
+        auto e = scn::scan("time=12", "tame={}", a);
+        CHECK(!e);
+        CHECK(e.error() == scn::error::invalid_scanned_value);
+        CHECK(e.range_as_string() == "time=12");
+    }
+    SUBCASE("end of range")
+    {
+        int a{};
+        auto e = scn::scan("tim", "time={}", a);
+        CHECK(!e);
+        CHECK(e.error() == scn::error::end_of_range);
+    }
+    SUBCASE("escaped braces")
+    {
+        int a{};
+        auto e = scn::scan("{x}=42", "{{x}}={}", a);
+        CHECK(e);
+        CHECK(a == 42);
+    }
+    SUBCASE("utf8")
+    {
+        int a{};
+        auto e = scn::scan("åäö=1", "åäö={}", a);
+        CHECK(e);
+        CHECK(a == 1);
+    }
+    SUBCASE("segmented")
+    {
+        std::vector<scn::span<const char>> chain = {
+            scn::make_span("ti", 2), scn::make_span("me=1", 4),
+            scn::make_span("2 le", 4), scn::make_span("vel=3", 5)};
+        scn::segmented_range r{scn::make_span(chain).as_const()};
+        int a{}, b{};
+        auto e = scn::scan(r, "time={} level={}", a, b);
+        CHECK(e);
+        CHECK(a == 12);
+        CHECK(b == 3);
+    }
+    SUBCASE("segmented mismatch")
+    {
+        std::vector<scn::span<const char>> chain = {
+            scn::make_span("ti", 2), scn::make_span("ne=1", 4)};
+        scn::segmented_range r{scn::make_span(chain).as_const()};
+        int a{};
+        auto e = scn::scan(r, "time={}", a);
+        CHECK(!e);
+        CHECK(e.error() == scn::error::invalid_scanned_value);
+        CHECK(e.range().begin().position() == 0);
+    }
+    SUBCASE("no buffer access")
+    {
+        std::string src{"time=12"};
+        std::deque<char> d{src.begin(), src.end()};
+        int a{};
+        auto e = scn::scan(d, "time={}", a);
+        CHECK(e);
+        CHECK(a == 12);
+    }
+}
@@ -473,6 +473,123 @@ TEST_CASE_TEMPLATE_DEFINE("integer", T, integer_test)
     }
 }
 
+TEST_CASE("integer power of two bases")
+{
+    SUBCASE("hex")
+    {
+        unsigned long long u{};
+        auto ret = scn::scan("0123456789abcdefABCDEF", "{:x}", u);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+
+        ret = scn::scan("deadBEEFcafe0042 rest", "{:x}", u);
+        CHECK(ret);
+        CHECK(u == 0xdeadbeefcafe0042ull);
+        CHECK(ret.range_as_string() == " rest");
+
+        ret = scn::scan("ffffffffffffffff", "{:x}", u);
+        CHECK(ret);
+        CHECK(u == 0xffffffffffffffffull);
+
+        ret = scn::scan("00000000ffffffffffffffff", "{:x}", u);
+        CHECK(ret);
+        CHECK(u == 0xffffffffffffffffull);
+
+        ret = scn::scan("10000000000000000", "{:x}", u);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+
+        // Not a digit inside of the first eight
+        ret = scn::scan("1234g6789", "{:x}", u);
+        CHECK(ret);
+        CHECK(u == 0x1234);
+        CHECK(ret.range_as_string() == "g6789");
+
+        // Not a digit inside of the second eight
+        ret = scn::scan("0x123456789abcdeXf", "{:i}", u);
+        CHECK(ret);
+        CHECK(u == 0x123456789abcdeull);
+        CHECK(ret.range_as_string() == "Xf");
+    }
+    SUBCASE("hex signed")
+    {
+        int i{};
+        auto ret = scn::scan("7fffffff", "{:x}", i);
+        CHECK(ret);
+        CHECK(i == 0x7fffffff);
+
+        ret = scn::scan("80000000", "{:x}", i);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+
+        ret = scn::scan("-80000000", "{:x}", i);
+        CHECK(ret);
+        CHECK(i == std::numeric_limits<int>::min());
+
+        ret = scn::scan("-80000001", "{:x}", i);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+
+        short s{};
+        ret = scn::scan("-8000", "{:x}", s);
+        CHECK(ret);
+        CHECK(s == std::numeric_limits<short>::min());
+
+        ret = scn::scan("10000", "{:x}", s);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+    }
+    SUBCASE("octal")
+    {
+        unsigned long long u{};
+        auto ret = scn::scan("1777777777777777777777", "{:o}", u);
+        CHECK(ret);
+        CHECK(u == 0xffffffffffffffffull);
+
+        ret = scn::scan("2000000000000000000000", "{:o}", u);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+
+        unsigned v{};
+        ret = scn::scan("0o1234567012", "{:i}", v);
+        CHECK(ret);
+        CHECK(v == 01234567012u);
+
+        ret = scn::scan("123456789", "{:o}", v);
+        CHECK(ret);
+        CHECK(v == 01234567u);
+        CHECK(ret.range_as_string() == "89");
+    }
+    SUBCASE("binary")
+    {
+        unsigned u{};
+        auto ret = scn::scan("0b11111111000000001111111100000000", "{:i}",
+                             u);
+        CHECK(ret);
+        CHECK(u == 0xff00ff00u);
+
+        ret = scn::scan("111111110000000011111111000000001", "{:B2}", u);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+
+        unsigned char c{};
+        ret = scn::scan("0000000011111111", "{:B2}", c);
+        CHECK(ret);
+        CHECK(c == 0xff);
+
+        ret = scn::scan("0000000111111111", "{:B2}", c);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+    }
+    SUBCASE("wide")
+    {
+        unsigned long long u{};
+        auto ret = scn::scan(L"deadBEEFcafe0042", L"{:x}", u);
+        CHECK(ret);
+        CHECK(u == 0xdeadbeefcafe0042ull);
+    }
+}
+
 TEST_CASE("integer decimal separator")
 {
     int i{};
@@ -979,3 +1096,64 @@ TEST_CASE("int as c") {
     CHECK(i == '1');
     CHECK(ret.range().empty());
 }
+
+TEST_CASE_TEMPLATE("unchecked", CharT, char, wchar_t)
+{
+    int i{};
+    long long ll{};
+    unsigned u{};
+    auto ret = scn::scan_unchecked(widen<CharT>("-42 +9000000000 7"),
+                                   widen<CharT>("{} {} {}"), i, ll, u);
+    CHECK(ret);
+    CHECK(i == -42);
+    CHECK(ll == 9000000000LL);
+    CHECK(u == 7);
+    CHECK(ret.range().empty());
+
+    ret = scn::scan_default_unchecked(widen<CharT>("2147483647 -2147483648"),
+                                      i, ll);
+    CHECK(ret);
+    CHECK(i == std::numeric_limits<int>::max());
+    CHECK(ll == -2147483648LL);
+
+    ret = scn::scan_unchecked(widen<CharT>("12abc"), widen<CharT>("{}"), i);
+    CHECK(ret);
+    CHECK(i == 12);
+    CHECK(ret.range_as_string() == widen<CharT>("abc"));
+
+    i = 0;
+    ret = scn::scan_unchecked(widen<CharT>("abc"), widen<CharT>("{}"), i);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+    CHECK(i == 0);
+
+    ret = scn::scan_unchecked(widen<CharT>("-1"), widen<CharT>("{}"), u);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+
+    ret = scn::scan_unchecked(widen<CharT>(""), widen<CharT>("{}"), i);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::end_of_range);
+
+    // options fall back on the regular scanner
+    ret = scn::scan_unchecked(widen<CharT>("ff"), widen<CharT>("{:x}"), i);
+    CHECK(ret);
+    CHECK(i == 0xff);
+
+    // base detection isn't decimal
+    ret = scn::scan_unchecked(widen<CharT>("0x1F 010"), widen<CharT>("{:i}"),
+                              i);
+    CHECK(ret);
+    CHECK(i == 0x1f);
+    ret = scn::scan_unchecked(ret.range(), widen<CharT>("{:i}"), i);
+    CHECK(ret);
+    CHECK(i == 010);
+    ret = scn::scan_default_unchecked(widen<CharT>("0x1F"), i);
+    CHECK(ret);
+    CHECK(i == 0x1f);
+
+    auto src = get_deque<CharT>(widen<CharT>("123"));
+    auto dret = scn::scan_unchecked(src, widen<CharT>("{}"), i);
+    CHECK(dret);
+    CHECK(i == 123);
+}
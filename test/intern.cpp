@@ -0,0 +1,187 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "test.h"
+
+enum class level { debug, info, warn, error };
+
+static const scn::symbol_table<level>& levels()
+{
+    static const auto table = scn::symbol_table<level>{
+        {"DEBUG", level::debug},
+        {"INFO", level::info},
+        {"WARN", level::warn},
+        {"ERROR", level::error},
+        {"WARN", level::error}};
+    return table;
+}
+
+TEST_CASE("symbol_table find")
+{
+    const auto& table = levels();
+    CHECK(table.size() == 4);
+    REQUIRE(table.find("INFO"));
+    CHECK(*table.find("INFO") == level::info);
+    REQUIRE(table.find("WARN"));
+    CHECK(*table.find("WARN") == level::warn);
+    CHECK(!table.find("INF"));
+    CHECK(!table.find("INFOO"));
+    CHECK(!table.find("info"));
+    CHECK(!table.find(""));
+
+    auto empty = scn::symbol_table<>{};
+    CHECK(empty.size() == 0);
+    CHECK(!empty.find("INFO"));
+}
+
+TEST_CASE("symbol_table many")
+{
+    std::vector<std::string> tokens;
+    for (int i = 0; i < 1000; ++i) {
+        tokens.push_back("tok" + std::to_string(i * 7));
+    }
+    std::vector<scn::symbol_table<>::symbol> symbols;
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        symbols.push_back({{tokens[i].data(), tokens[i].size()},
+                           static_cast<int>(i)});
+    }
+    auto table = scn::symbol_table<>(symbols.begin(), symbols.end());
+    tokens.clear();
+
+    CHECK(table.size() == 1000);
+    for (int i = 0; i < 7000; ++i) {
+        auto tok = "tok" + std::to_string(i);
+        auto v = table.find({tok.data(), tok.size()});
+        if (i % 7 == 0) {
+            REQUIRE(v);
+            CHECK(*v == i / 7);
+        }
+        else {
+            CHECK(!v);
+        }
+    }
+}
+
+TEST_CASE("symbol_table duplicates")
+{
+    std::vector<std::string> tokens;
+    for (int i = 0; i < 2000; ++i) {
+        tokens.push_back("tok" + std::to_string(i));
+    }
+    // every token twice: the first value is kept
+    std::vector<scn::symbol_table<>::symbol> symbols;
+    for (int pass = 0; pass < 2; ++pass) {
+        for (size_t i = 0; i < tokens.size(); ++i) {
+            symbols.push_back({{tokens[i].data(), tokens[i].size()},
+                               static_cast<int>(i) + pass * 10000});
+        }
+    }
+    auto table = scn::symbol_table<>(symbols.begin(), symbols.end());
+
+    CHECK(table.size() == 2000);
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        auto v = table.find({tokens[i].data(), tokens[i].size()});
+        REQUIRE(v);
+        CHECK(*v == static_cast<int>(i));
+    }
+}
+
+TEST_CASE("interned")
+{
+    auto lvl = scn::interned<level>{levels()};
+    std::string msg;
+    auto ret = scn::scan("WARN disk full", "{} {}", lvl, msg);
+    CHECK(ret);
+    CHECK(lvl.value == level::warn);
+    CHECK(lvl.known());
+    CHECK(msg == "disk");
+
+    ret = scn::scan("[ERROR]", "[{:[A-Z]}]", lvl);
+    CHECK(ret);
+    CHECK(lvl.value == level::error);
+    CHECK(ret.empty());
+
+    ret = scn::scan_default("  DEBUG", lvl);
+    CHECK(ret);
+    CHECK(lvl.value == level::debug);
+}
+
+TEST_CASE("interned unknown")
+{
+    auto lvl = scn::interned<level>{levels()};
+    lvl.value = level::info;
+    auto ret = scn::scan_default("TRACE x", lvl);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+    CHECK(ret.range_as_string() == "TRACE x");
+    CHECK(lvl.value == level::info);
+
+    lvl.allow_unknown = true;
+    ret = scn::scan_default("TRACE x", lvl);
+    CHECK(ret);
+    CHECK(!lvl.known());
+    CHECK(lvl.value == level::info);
+    CHECK(std::string{lvl.unknown.data(), lvl.unknown.size()} == "TRACE");
+    CHECK(ret.range_as_string() == " x");
+
+    ret = scn::scan_default("ERROR", lvl);
+    CHECK(ret);
+    CHECK(lvl.known());
+    CHECK(lvl.value == level::error);
+}
+
+TEST_CASE("interned non-contiguous")
+{
+    auto lvl = scn::interned<level>{levels(), true};
+    auto src = get_deque<char>("INFO TRACE");
+    auto ret = scn::scan_default(src, lvl);
+    CHECK(ret);
+    CHECK(lvl.value == level::info);
+
+    ret = scn::scan_default(ret.range(), lvl);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_operation);
+}
+
+TEST_CASE("interned segmented")
+{
+    auto lvl = scn::interned<level>{levels(), true};
+    std::string source{"INFO TRACE"};
+    std::vector<scn::span<const char>> segments{
+        {source.data(), 7}, {source.data() + 7, 3}};
+    scn::segmented_range r{scn::make_span(segments).as_const()};
+    auto ret = scn::scan_default(r, lvl);
+    CHECK(ret);
+    CHECK(lvl.value == level::info);
+
+    // "TRACE" straddles the segments, and is pinned by copying
+    ret = scn::scan_default(ret.range(), lvl);
+    CHECK(ret);
+    CHECK(!lvl.known());
+    CHECK(std::string{lvl.unknown.data(), lvl.unknown.size()} == "TRACE");
+    r.release_pinned();
+}
+
+TEST_CASE("interned wide")
+{
+    auto table = scn::wsymbol_table<>{{L"GET", 1}, {L"PUT", 2}};
+    auto method = scn::winterned<>{table};
+    auto ret = scn::scan_default(L"PUT /", method);
+    CHECK(ret);
+    CHECK(method.value == 2);
+}
@@ -33,6 +33,20 @@ struct my_type {
     }
 };
 
+struct putback_type {
+    char putback{};
+    int value{};
+
+    friend std::istream& operator>>(std::istream& is, putback_type& val)
+    {
+        is.get();
+        if (is.putback(val.putback)) {
+            is >> val.value;
+        }
+        return is;
+    }
+};
+
 TEST_CASE("istream value")
 {
     my_type val{};
@@ -99,3 +113,45 @@ TEST_CASE("istream composite error")
     CHECK(ret);
     CHECK(s == "foo");
 }
+
+TEST_CASE("istream range position")
+{
+    my_type a{}, b{};
+
+    SUBCASE("contiguous")
+    {
+        auto ret = scn::scan("123 456 rest", "{} {}", a, b);
+        CHECK(ret);
+        CHECK(a.value == 123);
+        CHECK(b.value == 456);
+        CHECK(ret.range_as_string() == " rest");
+    }
+    SUBCASE("non-contiguous")
+    {
+        auto ret = scn::scan(get_deque<char>("123 456 rest"), "{} {}", a, b);
+        CHECK(ret);
+        CHECK(a.value == 123);
+        CHECK(b.value == 456);
+
+        std::string s;
+        ret = scn::scan_default(ret.range(), s);
+        CHECK(ret);
+        CHECK(s == "rest");
+    }
+}
+
+TEST_CASE("istream putback")
+{
+    putback_type val{};
+    val.putback = '1';
+    auto ret = scn::scan("123", "{}", val);
+    CHECK(ret);
+    CHECK(val.value == 123);
+
+    // The get area points into the source, and can't be written into
+    val = putback_type{};
+    val.putback = 'x';
+    ret = scn::scan("123", "{}", val);
+    CHECK(!ret);
+    CHECK(val.value == 0);
+}
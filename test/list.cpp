@@ -80,3 +80,97 @@ TEST_CASE("comma list until line break")
     CHECK(values.size() == cmp.size());
     CHECK(std::equal(values.begin(), values.end(), cmp.begin()));
 }
+
+TEST_CASE("list error")
+{
+    std::vector<int> values;
+    auto ret = scn::scan_list("123 456 abc", values);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+    CHECK(ret.range_as_string() == " abc");
+
+    std::vector<int> cmp{123, 456};
+    CHECK(values == cmp);
+}
+
+TEST_CASE("list appended to repeatedly")
+{
+    std::vector<int> values;
+    size_t reallocations = 0;
+    for (int i = 0; i < 1000; ++i) {
+        const auto cap = values.capacity();
+        auto ret = scn::scan_list("1 2 3", values);
+        CHECK(ret);
+        if (values.capacity() != cap) {
+            ++reallocations;
+        }
+    }
+    CHECK(values.size() == 3000);
+    // the capacity grows geometrically
+    CHECK(reallocations < 20);
+}
+
+TEST_CASE("list reserve with until")
+{
+    // the values after the line break aren't reserved for
+    auto source = std::string{"1 2 3\n"};
+    for (int i = 0; i < 100000; ++i) {
+        source += "4 ";
+    }
+    std::vector<int> values;
+    auto ret = scn::scan_list_ex(source, values, scn::list_until('\n'));
+    CHECK(ret);
+    CHECK(values.size() == 3);
+    CHECK(values.capacity() < 100);
+}
+
+TEST_CASE("list reserve at the front of a large source")
+{
+    // the list ends after three values, and the rest of the source
+    // isn't reserved for
+    auto source = std::string{"1 2 3 "};
+    source.append(size_t{1} << 22, 'x');
+    std::vector<long long> values;
+    auto ret = scn::scan_list(source, values);
+    CHECK(!ret);
+    CHECK(values.size() == 3);
+    CHECK(values.capacity() < 100);
+}
+
+TEST_CASE("list into span")
+{
+    std::vector<int> buffer(2, 0);
+    auto wrapper = scn::span_list_wrapper<int>(scn::make_span(buffer));
+    auto ret = scn::scan_list("1 2 3", wrapper);
+    CHECK(ret);
+    CHECK(ret.range_as_string() == "3");
+
+    std::vector<int> cmp{1, 2};
+    CHECK(buffer == cmp);
+}
+
+TEST_CASE_TEMPLATE("list non-contiguous", CharT, char, wchar_t)
+{
+    auto source = get_deque<CharT>(widen<CharT>("1, 2,3 , 4\n5"));
+    std::vector<int> values;
+    auto ret = scn::scan_list_ex(
+        source, values,
+        scn::list_separator_and_until(scn::detail::ascii_widen<CharT>(','),
+                                      scn::detail::ascii_widen<CharT>('\n')));
+    CHECK(ret);
+
+    std::vector<int> cmp{1, 2, 3, 4};
+    CHECK(values == cmp);
+}
+
+TEST_CASE("wide float list")
+{
+    std::vector<double> values;
+    auto ret = scn::scan_list_ex(L"1.5;-2;3e2", values,
+                                 scn::list_separator(L';'));
+    CHECK(ret);
+    REQUIRE(values.size() == 3);
+    CHECK(values[0] == doctest::Approx(1.5));
+    CHECK(values[1] == doctest::Approx(-2.0));
+    CHECK(values[2] == doctest::Approx(300.0));
+}
@@ -0,0 +1,126 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "test.h"
+
+#include <scn/parallel.h>
+
+static std::string make_list(int n, const char* sep)
+{
+    std::string str;
+    for (int i = 0; i < n; ++i) {
+        str += std::to_string(i * 37 - 1000);
+        str += sep;
+    }
+    return str;
+}
+
+TEST_CASE("parallel list")
+{
+    const auto source = make_list(1000, " ");
+
+    for (unsigned threads = 1; threads != 9; ++threads) {
+        std::vector<int> values;
+        auto ret = scn::scan_list_parallel(source, values, {}, threads, 16);
+        CHECK(ret);
+        CHECK(ret.index == 1000);
+        CHECK(ret.offset == source.size());
+        REQUIRE(values.size() == 1000);
+        for (int i = 0; i < 1000; ++i) {
+            CHECK(values[static_cast<size_t>(i)] == i * 37 - 1000);
+        }
+    }
+}
+
+TEST_CASE("parallel comma list")
+{
+    const auto source = make_list(1000, ", ");
+
+    std::vector<double> values;
+    auto ret = scn::scan_list_parallel(source, values,
+                                       scn::list_separator(','), 4, 16);
+    CHECK(ret);
+    REQUIRE(values.size() == 1000);
+    CHECK(values.front() == doctest::Approx(-1000.0));
+    CHECK(values.back() == doctest::Approx(999 * 37 - 1000));
+}
+
+TEST_CASE("parallel list until")
+{
+    auto source = make_list(1000, ",");
+    const auto until = source.size();
+    source += "\n1 2 3";
+
+    std::vector<int> values;
+    auto ret = scn::scan_list_parallel(source, values,
+                                       scn::list_separator_and_until(',', '\n'),
+                                       4, 16);
+    CHECK(ret);
+    CHECK(values.size() == 1000);
+    CHECK(ret.offset == until);
+}
+
+TEST_CASE("parallel list error")
+{
+    auto source = make_list(500, " ");
+    const auto offset = source.size();
+    source += "abc ";
+    source += make_list(500, " ");
+
+    std::vector<int> values;
+    auto ret = scn::scan_list_parallel(source, values, {}, 4, 16);
+    CHECK(!ret);
+    CHECK(ret.err == scn::error::invalid_scanned_value);
+    CHECK(ret.index == 500);
+    CHECK(ret.offset == offset);
+    CHECK(values.size() == 500);
+}
+
+TEST_CASE("parallel list max_size")
+{
+    const auto source = make_list(1000, " ");
+
+    std::vector<int> buffer(100, 0);
+    auto wrapper = scn::span_list_wrapper<int>(scn::make_span(buffer));
+    auto ret = scn::scan_list_parallel(source, wrapper, {}, 4, 16);
+    CHECK(ret);
+    CHECK(ret.index == 100);
+    CHECK(wrapper.size() == 100);
+    CHECK(buffer.back() == 99 * 37 - 1000);
+    // the list ends where the value that didn't fit begins
+    CHECK(ret.offset == make_list(100, " ").size());
+}
+
+TEST_CASE("parallel list small")
+{
+    std::vector<int> values;
+    auto ret = scn::scan_list_parallel("1 2 3", values);
+    CHECK(ret);
+    CHECK(values.size() == 3);
+
+    values.clear();
+    ret = scn::scan_list_parallel("", values);
+    CHECK(ret);
+    CHECK(values.empty());
+
+    std::vector<int> wvalues;
+    ret = scn::scan_list_parallel(L"4,5,6", wvalues, scn::list_separator(L','),
+                                  2, 1);
+    CHECK(ret);
+    CHECK(wvalues.size() == 3);
+}
@@ -151,6 +151,32 @@ TEST_CASE("custom locale")
         CHECK(!wloc.is_digit(L'@'));
     }
 
+    SUBCASE("ctype")
+    {
+        for (int i = 0; i < 256; ++i) {
+            const auto ch = static_cast<char>(i);
+            const auto& l = std::locale::classic();
+            CHECK(loc.is_alpha(ch) == std::isalpha(ch, l));
+            CHECK(loc.is_alnum(ch) == std::isalnum(ch, l));
+            CHECK(loc.is_punct(ch) == std::ispunct(ch, l));
+            CHECK(loc.is_upper(ch) == std::isupper(ch, l));
+            CHECK(loc.is_xdigit(ch) == std::isxdigit(ch, l));
+            CHECK(wloc.is_graph(static_cast<wchar_t>(i)) ==
+                  std::isgraph(static_cast<wchar_t>(i), l));
+        }
+        CHECK(wloc.is_alpha(L'\u00e4') ==
+              std::isalpha(L'\u00e4', std::locale::classic()));
+
+        CHECK(loc.is_ctype(scn::detail::ctype_alpha | scn::detail::ctype_digit,
+                           'a'));
+        CHECK(loc.is_ctype(scn::detail::ctype_alpha | scn::detail::ctype_digit,
+                           '0'));
+        CHECK(!loc.is_ctype(scn::detail::ctype_alpha | scn::detail::ctype_digit,
+                            '_'));
+        CHECK(loc.is_blank(scn::make_code_point(' ')));
+        CHECK(!loc.is_blank(scn::make_code_point('\n')));
+    }
+
     SUBCASE("decimal_point & thousands_separator")
     {
         CHECK(loc.decimal_point() == '.');
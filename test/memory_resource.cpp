@@ -0,0 +1,111 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "test.h"
+
+struct counting_resource : scn::memory_resource {
+    int allocations{0};
+    int deallocations{0};
+
+private:
+    void* do_allocate(size_t bytes, size_t align) override
+    {
+        ++allocations;
+        return scn::new_delete_resource()->allocate(bytes, align);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t align) override
+    {
+        ++deallocations;
+        scn::new_delete_resource()->deallocate(p, bytes, align);
+    }
+};
+
+TEST_CASE("monotonic_buffer_resource")
+{
+    counting_resource upstream{};
+
+    SUBCASE("initial buffer")
+    {
+        alignas(std::max_align_t) unsigned char buf[64];
+        scn::monotonic_buffer_resource r{buf, 64, &upstream};
+
+        auto a = r.allocate(3, 1);
+        auto b = r.allocate(8, 8);
+        CHECK(a == buf);
+        CHECK(b == buf + 8);
+        CHECK(upstream.allocations == 0);
+
+        auto c = r.allocate(128, 16);
+        CHECK(reinterpret_cast<std::uintptr_t>(c) % 16 == 0);
+        CHECK(upstream.allocations == 1);
+
+        r.release();
+        CHECK(upstream.deallocations == 1);
+        CHECK(r.allocate(3, 1) == buf);
+    }
+    SUBCASE("growth")
+    {
+        scn::monotonic_buffer_resource r{16, &upstream};
+        for (int i = 0; i < 16; ++i) {
+            r.allocate(16, 8);
+        }
+        CHECK(upstream.allocations < 16);
+        r.release();
+        CHECK(upstream.allocations == upstream.deallocations);
+    }
+}
+
+TEST_CASE("default resource")
+{
+    CHECK(scn::get_default_resource() == scn::new_delete_resource());
+
+    counting_resource r{};
+    {
+        scn::scoped_default_resource guard{&r};
+        CHECK(scn::get_default_resource() == &r);
+    }
+    CHECK(scn::get_default_resource() == scn::new_delete_resource());
+}
+
+TEST_CASE("scanning with a resource")
+{
+    counting_resource r{};
+    scn::scoped_default_resource guard{&r};
+
+    SUBCASE("int with thousands separators")
+    {
+        long long i{};
+        auto ret = scn::scan(get_deque<char>("123,456789012345678"),
+                             "{:'}", i);
+        CHECK(ret);
+        CHECK(i == 123456789012345678ll);
+        CHECK(r.allocations > 0);
+        CHECK(r.allocations == r.deallocations);
+    }
+    SUBCASE("output")
+    {
+        using string_type = std::basic_string<char, std::char_traits<char>,
+                                              scn::polymorphic_allocator<char>>;
+        string_type str{};
+        auto ret = scn::scan("a_rather_long_word_that_needs_the_heap", "{}",
+                             str);
+        CHECK(ret);
+        CHECK(str == "a_rather_long_word_that_needs_the_heap");
+        CHECK(r.allocations > 0);
+    }
+}
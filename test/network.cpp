@@ -0,0 +1,163 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <scn/network.h>
+
+#include "test.h"
+
+template <size_t N>
+static std::vector<int> to_vec(const std::array<unsigned char, N>& a)
+{
+    return std::vector<int>(a.begin(), a.end());
+}
+
+TEST_CASE("ipv4_address")
+{
+    scn::ipv4_address a{};
+    auto ret = scn::scan_default("192.168.0.255:8080", a);
+    CHECK(ret);
+    CHECK(to_vec(a.bytes) == std::vector<int>{192, 168, 0, 255});
+    CHECK(ret.range_as_string() == ":8080");
+
+    ret = scn::scan_default("0.0.0.0", a);
+    CHECK(ret);
+    CHECK(to_vec(a.bytes) == std::vector<int>{0, 0, 0, 0});
+
+    for (auto src : {"256.1.1.1", "1.2.3", "1.2.3.04", "1..2.3", "1.2.3.4444",
+                     "a.b.c.d"}) {
+        ret = scn::scan_default(scn::string_view{src}, a);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+    }
+
+    ret = scn::scan_default("", a);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::end_of_range);
+}
+
+TEST_CASE("ipv6_address")
+{
+    scn::ipv6_address a{};
+    auto ret = scn::scan_default("2001:db8:0:0:1:0:0:1", a);
+    CHECK(ret);
+    CHECK(to_vec(a.bytes) == std::vector<int>{0x20, 0x01, 0x0d, 0xb8, 0, 0,
+                                              0, 0, 0, 1, 0, 0, 0, 0, 0, 1});
+
+    ret = scn::scan_default("2001:DB8::1 rest", a);
+    CHECK(ret);
+    CHECK(to_vec(a.bytes) == std::vector<int>{0x20, 0x01, 0x0d, 0xb8, 0, 0,
+                                              0, 0, 0, 0, 0, 0, 0, 0, 0, 1});
+    CHECK(ret.range_as_string() == " rest");
+
+    ret = scn::scan_default("::", a);
+    CHECK(ret);
+    CHECK(to_vec(a.bytes) == std::vector<int>(16, 0));
+
+    ret = scn::scan_default("fe80::", a);
+    CHECK(ret);
+    CHECK(a.bytes[0] == 0xfe);
+    CHECK(a.bytes[15] == 0);
+
+    ret = scn::scan_default("::ffff:192.0.2.1", a);
+    CHECK(ret);
+    CHECK(to_vec(a.bytes) == std::vector<int>{0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                              0xff, 0xff, 192, 0, 2, 1});
+
+    ret = scn::scan_default("fe80::1%eth0", a);
+    CHECK(ret);
+    CHECK(a.bytes[15] == 1);
+    CHECK(ret.range_as_string() == "%eth0");
+
+    for (auto src :
+         {"1:2:3:4:5:6:7", "1::2::3", "12345::", "1:2:3:4:5:6:7::8",
+          ":1::", "g::"}) {
+        ret = scn::scan_default(scn::string_view{src}, a);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+    }
+}
+
+TEST_CASE("uuid")
+{
+    scn::uuid u{};
+    auto ret = scn::scan_default("123e4567-E89B-12d3-a456-426614174000,", u);
+    CHECK(ret);
+    CHECK(to_vec(u.bytes) ==
+          std::vector<int>{0x12, 0x3e, 0x45, 0x67, 0xe8, 0x9b, 0x12, 0xd3,
+                           0xa4, 0x56, 0x42, 0x66, 0x14, 0x17, 0x40, 0x00});
+    CHECK(ret.range_as_string() == ",");
+
+    for (auto src : {"123e4567-e89b-12d3-a456-42661417400",
+                     "123e4567+e89b-12d3-a456-426614174000",
+                     "123e4567-e89b-12d3-a456-42661417400g",
+                     "123e4567e89b12d3a456426614174000"}) {
+        ret = scn::scan_default(scn::string_view{src}, u);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+    }
+}
+
+TEST_CASE("mac_address")
+{
+    scn::mac_address m{};
+    auto ret = scn::scan_default("00:1a:2B:3c:4d:ff", m);
+    CHECK(ret);
+    CHECK(to_vec(m.bytes) ==
+          std::vector<int>{0x00, 0x1a, 0x2b, 0x3c, 0x4d, 0xff});
+
+    ret = scn::scan_default("00-1A-2B-3C-4D-5E", m);
+    CHECK(ret);
+    CHECK(m.bytes[5] == 0x5e);
+
+    for (auto src :
+         {"00:1a:2b-3c:4d:5e", "00:1a:2b:3c:4d", "00:1a:2b:3c:4d:5"}) {
+        ret = scn::scan_default(scn::string_view{src}, m);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+    }
+}
+
+TEST_CASE_TEMPLATE("addresses non-contiguous", CharT, char, wchar_t)
+{
+    auto src = get_deque<CharT>(
+        widen<CharT>("10.0.0.1 ::1 123e4567-e89b-12d3-a456-426614174000 "
+                     "00:1a:2b:3c:4d:5e"));
+    scn::ipv4_address a4{};
+    scn::ipv6_address a6{};
+    scn::uuid u{};
+    scn::mac_address m{};
+    auto ret = scn::scan_default(src, a4, a6, u, m);
+    CHECK(ret);
+    CHECK(a4.bytes[0] == 10);
+    CHECK(a6.bytes[15] == 1);
+    CHECK(u.bytes[15] == 0);
+    CHECK(u.bytes[0] == 0x12);
+    CHECK(m.bytes[5] == 0x5e);
+}
+
+TEST_CASE("addresses wide")
+{
+    scn::uuid u{};
+    scn::mac_address m{};
+    auto ret = scn::scan_default(
+        L"123e4567-e89b-12d3-a456-426614174000 00-1a-2b-3c-4d-5e", u, m);
+    CHECK(ret);
+    CHECK(u.bytes[6] == 0x12);
+    CHECK(m.bytes[0] == 0);
+    CHECK(m.bytes[1] == 0x1a);
+}
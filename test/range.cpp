@@ -128,6 +128,68 @@ TEST_CASE("mapped_file")
         "");
 }
 
+namespace {
+    struct contiguous_point {
+        int x, y;
+    };
+}  // namespace
+namespace scn {
+    template <>
+    struct scanner<contiguous_point> : public scn::empty_parser {
+        template <typename Context>
+        error scan(contiguous_point& val, Context& ctx)
+        {
+            return scan_usertype(ctx, "[{}, {}]", val.x, val.y);
+        }
+    };
+}  // namespace scn
+
+TEST_CASE("contiguous range through string_view backend")
+{
+    using wrapped = scn::range_wrapper_for_t<const std::vector<char>&>;
+    static_assert(
+        std::is_same<scn::detail::vscan_backend<wrapped>::type,
+                     scn::detail::range_wrapper<scn::string_view>>::value,
+        "");
+    static_assert(
+        std::is_same<
+            scn::detail::vscan_backend<scn::detail::range_wrapper<
+                scn::string_view>>::type,
+            scn::detail::range_wrapper<scn::string_view>>::value,
+        "");
+
+    const auto source = std::string{"123 [4, 5] 6 abc"};
+    const auto vec = std::vector<char>(source.begin(), source.end());
+
+    int a{}, b{};
+    contiguous_point p{};
+    auto ret = scn::scan(vec, "{} {}", a, p);
+    CHECK(ret);
+    CHECK(a == 123);
+    CHECK(p.x == 4);
+    CHECK(p.y == 5);
+    CHECK(ret.range().size() == 6);
+
+    ret = scn::scan_default(ret.range(), a, b);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+    CHECK(ret.range().size() == 6);
+
+    ret = scn::scan_default(ret.range(), a);
+    CHECK(ret);
+    CHECK(a == 6);
+    CHECK(ret.range().size() == 4);
+
+    auto value_ret = scn::scan_value<int>(vec);
+    CHECK(value_ret);
+    CHECK(value_ret.value() == 123);
+    CHECK(value_ret.range().size() == source.size() - 3);
+
+    auto empty_ret = scn::scan_default(std::vector<char>{}, a);
+    CHECK(!empty_ret);
+    CHECK(empty_ret.error() == scn::error::end_of_range);
+}
+
 TEST_CASE("get_buffer")
 {
     std::string first{"123"}, second{"456"};
@@ -0,0 +1,203 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "test.h"
+
+#include <vector>
+
+// Splits `str` into segments at `splits`
+static std::vector<scn::span<const char>> make_segments(
+    const std::string& str,
+    std::vector<size_t> splits)
+{
+    std::vector<scn::span<const char>> ret;
+    size_t begin = 0;
+    splits.push_back(str.size());
+    for (auto end : splits) {
+        ret.push_back(scn::span<const char>{str.data() + begin, end - begin});
+        begin = end;
+    }
+    return ret;
+}
+
+static std::string to_string(scn::string_view sv)
+{
+    return {sv.data(), sv.size()};
+}
+
+static bool points_into(const std::string& str, scn::string_view sv)
+{
+    return sv.data() >= str.data() &&
+           sv.data() + sv.size() <= str.data() + str.size();
+}
+
+TEST_CASE("segmented_range iterator")
+{
+    std::string source{"abcdefgh"};
+    auto segments = make_segments(source, {0, 3, 3, 5});
+    scn::segmented_range r{scn::make_span(segments).as_const()};
+    CHECK(r.size() == 8);
+
+    std::string chars{};
+    for (auto ch : r) {
+        chars.push_back(ch);
+    }
+    CHECK(chars == source);
+
+    auto it = r.begin();
+    CHECK(it.segment_index() == 1);
+    it += 3;
+    CHECK(*it == 'd');
+    CHECK(it.segment_index() == 3);
+    CHECK(it.position() == 3);
+    it += 4;
+    CHECK(*it == 'h');
+    CHECK(r.end() - it == 1);
+    --it;
+    CHECK(*it == 'g');
+    it -= 4;
+    CHECK(*it == 'c');
+    CHECK(it.segment_index() == 1);
+    ++it;
+    CHECK(*it == 'd');
+    CHECK(it - r.begin() == 3);
+
+    auto end = r.end();
+    --end;
+    CHECK(*end == 'h');
+    CHECK(r.begin()[5] == 'f');
+}
+
+TEST_CASE("segmented_range get_buffer")
+{
+    std::string source{"abcdefgh"};
+    auto segments = make_segments(source, {3, 5});
+    scn::segmented_range r{scn::make_span(segments).as_const()};
+
+    auto it = r.begin() + 1;
+    auto buf = r.get_buffer(it, 10);
+    CHECK(buf.size() == 2);
+    CHECK(buf.data() == source.data() + 1);
+
+    it += 2;
+    buf = r.get_buffer(it, 1);
+    CHECK(buf.size() == 1);
+    CHECK(buf.data() == source.data() + 3);
+
+    CHECK(r.get_buffer(r.end(), 10).size() == 0);
+}
+
+TEST_CASE("segmented_range scanning")
+{
+    std::string source{"123 4567 word -8.25 other"};
+    // boundaries inside "4567", "word", "-8.25", and "other"
+    auto segments = make_segments(source, {1, 6, 11, 15, 22});
+    scn::segmented_range r{scn::make_span(segments).as_const()};
+
+    int i{}, j{};
+    std::string word{};
+    double d{};
+    scn::string_view other{};
+    auto ret = scn::scan(r, "{} {} {} {} {}", i, j, word, d, other);
+    CHECK(ret);
+    CHECK(i == 123);
+    CHECK(j == 4567);
+    CHECK(word == "word");
+    CHECK(d == doctest::Approx(-8.25));
+    CHECK(to_string(other) == "other");
+    CHECK(ret.range().empty());
+    CHECK(ret.range().begin().position() == source.size());
+}
+
+TEST_CASE("segmented_range string_view")
+{
+    std::string source{"first second third fourth"};
+    // "second" straddles a boundary, "third" fits in a segment, "fourth"
+    // ends at the end of the last segment
+    auto segments = make_segments(source, {9, 19});
+    scn::segmented_range r{scn::make_span(segments).as_const()};
+
+    scn::string_view a{}, b{}, c{}, d{};
+    auto ret = scn::scan(r, "{} {} {} {}", a, b, c, d);
+    CHECK(ret);
+    CHECK(to_string(a) == "first");
+    CHECK(to_string(b) == "second");
+    CHECK(to_string(c) == "third");
+    CHECK(to_string(d) == "fourth");
+
+    CHECK(points_into(source, a));
+    CHECK(!points_into(source, b));
+    CHECK(points_into(source, c));
+    CHECK(points_into(source, d));
+}
+
+TEST_CASE("segmented_range continue")
+{
+    std::string source{"10 20 30"};
+    auto segments = make_segments(source, {1, 2, 4});
+    scn::segmented_range r{scn::make_span(segments).as_const()};
+
+    int a{}, b{}, c{};
+    auto ret = scn::scan(r, "{}", a);
+    CHECK(ret);
+    CHECK(a == 10);
+    ret = scn::scan(ret.range(), "{} {}", b, c);
+    CHECK(ret);
+    CHECK(b == 20);
+    CHECK(c == 30);
+
+    ret = scn::scan(ret.range(), "{}", a);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::end_of_range);
+}
+
+TEST_CASE("segmented_range getline and ignore")
+{
+    std::string source{"line one\nline two\nrest"};
+    auto segments = make_segments(source, {4, 10, 13});
+    scn::segmented_range r{scn::make_span(segments).as_const()};
+
+    std::string line{};
+    auto ret = scn::getline(r, line);
+    CHECK(ret);
+    CHECK(line == "line one");
+
+    ret = scn::ignore_until(ret.range(), '\n');
+    CHECK(ret);
+
+    std::string rest{};
+    ret = scn::scan(ret.range(), "\n{}", rest);
+    CHECK(ret);
+    CHECK(rest == "rest");
+}
+
+TEST_CASE("wsegmented_range")
+{
+    std::wstring source{L"42 wide"};
+    std::vector<scn::span<const wchar_t>> segments{
+        scn::span<const wchar_t>{source.data(), 4},
+        scn::span<const wchar_t>{source.data() + 4, source.size() - 4}};
+    scn::wsegmented_range r{scn::make_span(segments).as_const()};
+
+    int i{};
+    std::wstring s{};
+    auto ret = scn::scan(r, L"{} {}", i, s);
+    CHECK(ret);
+    CHECK(i == 42);
+    CHECK(s == L"wide");
+}
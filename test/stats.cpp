@@ -0,0 +1,145 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "test.h"
+
+#include <cstdio>
+
+#if !SCN_ENABLE_STATS
+#error "test-stats must be built with SCN_ENABLE_STATS"
+#endif
+
+TEST_CASE("stats reset")
+{
+    scn::detail::stats_ref().putbacks = 42;
+    CHECK(scn::get_scan_stats().putbacks == 42);
+
+    scn::reset_scan_stats();
+    CHECK(scn::get_scan_stats().putbacks == 0);
+}
+
+TEST_CASE("stats chars_read")
+{
+    scn::reset_scan_stats();
+
+    int i{}, j{};
+    double d{};
+    auto ret = scn::scan("123 4567 1.25", "{} {} {}", i, j, d);
+    CHECK(ret);
+
+    auto stats = scn::get_scan_stats();
+    CHECK(scn::chars_read_for<int>(stats) == 7);
+    CHECK(scn::chars_read_for<double>(stats) == 4);
+    CHECK(scn::chars_read_for<long>(stats) == 0);
+    CHECK(stats.rollbacks == 0);
+
+    std::vector<int> list;
+    ret = scn::scan_list("1 2 3", list);
+    CHECK(ret);
+    CHECK(scn::chars_read_for<int>(scn::get_scan_stats()) > 7);
+
+    scn::reset_scan_stats();
+    auto v = scn::scan_value<double>("1.5");
+    CHECK(v);
+    CHECK(scn::chars_read_for<double>(scn::get_scan_stats()) == 3);
+}
+
+TEST_CASE("stats rollback and putback")
+{
+    scn::reset_scan_stats();
+
+    int i{}, j{};
+    auto ret = scn::scan("123 abc", "{} {}", i, j);
+    CHECK(!ret);
+    CHECK(scn::get_scan_stats().rollbacks == 1);
+
+    scn::reset_scan_stats();
+    auto r = scn::wrap(scn::string_view{"abc"});
+    r.advance(2);
+    auto e = scn::putback_n(r, 2);
+    CHECK(e);
+
+    auto stats = scn::get_scan_stats();
+    CHECK(stats.putbacks == 1);
+    CHECK(stats.putback_chars == 2);
+}
+
+TEST_CASE("stats allocations")
+{
+    scn::reset_scan_stats();
+
+    {
+        scn::detail::small_vector<int, 2> v(16);
+        scn::detail::resource_string<char> s(256, 'a');
+    }
+
+    auto stats = scn::get_scan_stats();
+    CHECK(stats.allocations == 2);
+    CHECK(stats.allocated_bytes >= 16 * sizeof(int) + 256);
+}
+
+TEST_CASE("stats float fallback")
+{
+    scn::reset_scan_stats();
+
+    double d{};
+    auto ret = scn::scan(L"1.5", L"{}", d);
+    CHECK(ret);
+    CHECK(d == doctest::Approx(1.5));
+    CHECK(scn::get_scan_stats().float_strtod == 1);
+}
+
+TEST_CASE("stats file")
+{
+    auto f = std::tmpfile();
+    REQUIRE(f);
+    std::fputs("42 abc", f);
+    std::rewind(f);
+
+    scn::reset_scan_stats();
+    {
+        scn::file file{f};
+        int i{};
+        auto ret = scn::scan_default(file, i);
+        CHECK(ret);
+        CHECK(i == 42);
+    }
+
+    CHECK(scn::get_scan_stats().file_reads >= 2);
+    std::fclose(f);
+}
+
+TEST_CASE("stats file block reads")
+{
+    auto f = std::tmpfile();
+    REQUIRE(f);
+    std::fputs("skipped\n42", f);
+    std::rewind(f);
+
+    scn::reset_scan_stats();
+    {
+        scn::file file{f};
+        auto ret = scn::ignore_until(file, '\n');
+        CHECK(ret);
+    }
+
+    // every character read in a block is counted, like with fgetc
+    CHECK(scn::get_scan_stats().file_reads == 10);
+    std::fclose(f);
+}
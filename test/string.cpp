@@ -112,6 +112,65 @@ TEST_CASE_TEMPLATE("getline", CharT, char, wchar_t)
     }
 }
 
+TEST_CASE_TEMPLATE("lines", CharT, char, wchar_t)
+{
+    using string_type = std::basic_string<CharT>;
+
+    auto collect = [](scn::basic_lines_view<CharT> view) {
+        std::vector<string_type> ret;
+        for (auto line : view) {
+            ret.emplace_back(line.data(), line.size());
+        }
+        return ret;
+    };
+
+    SUBCASE("basic")
+    {
+        string_type data = widen<CharT>("first\nsecond\n\nfourth");
+        auto lines = collect(scn::lines(data));
+        REQUIRE(lines.size() == 4);
+        CHECK(lines[0] == widen<CharT>("first"));
+        CHECK(lines[1] == widen<CharT>("second"));
+        CHECK(lines[2].empty());
+        CHECK(lines[3] == widen<CharT>("fourth"));
+    }
+    SUBCASE("trailing newline")
+    {
+        string_type data = widen<CharT>("first\nsecond\n");
+        auto lines = collect(scn::lines(data));
+        REQUIRE(lines.size() == 2);
+        CHECK(lines[1] == widen<CharT>("second"));
+    }
+    SUBCASE("empty")
+    {
+        string_type data{};
+        CHECK(collect(scn::lines(data)).empty());
+    }
+    SUBCASE("crlf")
+    {
+        string_type data = widen<CharT>("first\r\nsecond\r");
+        auto lines = collect(scn::lines(data));
+        REQUIRE(lines.size() == 2);
+        CHECK(lines[0] == widen<CharT>("first\r"));
+
+        lines = collect(scn::lines(data, true));
+        REQUIRE(lines.size() == 2);
+        CHECK(lines[0] == widen<CharT>("first"));
+        CHECK(lines[1] == widen<CharT>("second"));
+    }
+    SUBCASE("points to source")
+    {
+        auto view = scn::lines("foo\nbar");
+        auto it = view.begin();
+        CHECK(std::strncmp((*it).data(), "foo\nbar", 3) == 0);
+        ++it;
+        REQUIRE(it != view.end());
+        CHECK((*it).size() == 3);
+        ++it;
+        CHECK(it == view.end());
+    }
+}
+
 TEST_CASE_TEMPLATE("ignore", CharT, char, wchar_t)
 {
     using string_type = std::basic_string<CharT>;
@@ -140,6 +199,29 @@ TEST_CASE_TEMPLATE("ignore", CharT, char, wchar_t)
         CHECK(ret.range().size() == 0);
     }
 
+    SUBCASE("ignore_until_n")
+    {
+        auto ret = scn::ignore_until_n(data, 3, CharT{0x0a});
+        CHECK(ret);
+        CHECK(ret.range_as_string() == widen<CharT>("e1\nline2"));
+
+        ret = scn::ignore_until_n(ret.range(), 8, CharT{0x0a});
+        CHECK(ret);
+        CHECK(ret.range_as_string() == widen<CharT>("\nline2"));
+    }
+
+    SUBCASE("non-contiguous")
+    {
+        auto d = get_deque<CharT>(data);
+        auto ret = scn::ignore_until(d, CharT{0x0a});
+        CHECK(ret);
+
+        string_type s{};
+        ret = scn::scan_default(ret.range(), s);
+        CHECK(ret);
+        CHECK(s == widen<CharT>("line2"));
+    }
+
     SUBCASE("empty range")
     {
         string_type s{};
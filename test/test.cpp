@@ -123,6 +123,67 @@ TEST_CASE("value")
     CHECK(ret2.range_as_string() == "foo");
 }
 
+struct single_value_type {
+    int a, b;
+};
+namespace scn {
+    template <>
+    struct scanner<single_value_type> : common_parser_default {
+        template <typename Context>
+        error scan(single_value_type& val, Context& ctx)
+        {
+            return scan_usertype(ctx, "[{}, {}]", val.a, val.b);
+        }
+    };
+}  // namespace scn
+
+TEST_CASE("single value")
+{
+    SUBCASE("scan_value")
+    {
+        auto d = scn::scan_value<double>("  3.25 rest");
+        CHECK(d);
+        CHECK(d.value() == doctest::Approx(3.25));
+        CHECK(d.range_as_string() == " rest");
+
+        auto s = scn::scan_value<std::string>(d.range());
+        CHECK(s);
+        CHECK(s.value() == "rest");
+        CHECK(s.empty());
+
+        auto w = scn::scan_value<int>(L"123");
+        CHECK(w);
+        CHECK(w.value() == 123);
+
+        auto u = scn::scan_value<single_value_type>("[1, 2]");
+        CHECK(u);
+        CHECK(u.value().a == 1);
+        CHECK(u.value().b == 2);
+
+        auto e = scn::scan_value<int>("");
+        CHECK(!e);
+        CHECK(e.error() == scn::error::end_of_range);
+    }
+    SUBCASE("scan_default")
+    {
+        int i{};
+        auto ret = scn::scan_default("42 foo", i);
+        CHECK(ret);
+        CHECK(i == 42);
+        CHECK(ret.range_as_string() == " foo");
+
+        ret = scn::scan_default(ret.range(), i);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+        CHECK(ret.range_as_string() == " foo");
+
+        unsigned u{};
+        ret = scn::scan_default_unchecked("123", u);
+        CHECK(ret);
+        CHECK(u == 123);
+    }
+}
+
 TEST_CASE("temporary")
 {
     struct temporary {
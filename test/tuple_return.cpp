@@ -38,6 +38,19 @@ TEST_CASE("tuple_return")
     CHECK(s == std::string{"foo"});
 }
 
+TEST_CASE("tuple_return contiguous range")
+{
+    auto source = std::string{"42 foo bar"};
+    auto [r, i, s] = scn::scan_tuple<int, std::string>(
+        std::vector<char>(source.begin(), source.end()), "{} {}");
+
+    CHECK(r);
+    CHECK(r.range().size() == 4);
+
+    CHECK(i == 42);
+    CHECK(s == std::string{"foo"});
+}
+
 TEST_CASE("tuple_return int")
 {
     auto [r, i] = scn::scan_tuple_default<int>("42");
@@ -59,3 +59,28 @@ TEST_CASE("utf16")
     CHECK(cp == slightly_smiling_face);
     cp = zero;
 }
+
+TEST_CASE("utf16 decode_code_points")
+{
+    char16_t data[] = {0x61, 0xe4, 0x20ac, 0xd83d, 0xde42, 0x62};
+    auto input = scn::make_span(data, 6).as_const();
+
+    scn::code_point buf[8] = {};
+    auto ret = scn::decode_code_points(input, scn::make_span(buf, 8));
+    CHECK(ret);
+    CHECK(ret.value().chars.size() == 6);
+    CHECK(ret.value().code_points.size() == 5);
+    CHECK(buf[2] == scn::make_code_point(0x20ac));
+    CHECK(buf[3] == scn::make_code_point(0x1f642));
+    CHECK(buf[4] == scn::make_code_point('b'));
+
+    // lone lead surrogate at the end
+    ret = scn::decode_code_points(input.first(4), scn::make_span(buf, 8));
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_encoding);
+
+    // lone trail surrogate
+    ret = scn::decode_code_points(input.subspan(4), scn::make_span(buf, 8));
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_encoding);
+}
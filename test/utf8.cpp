@@ -101,6 +101,112 @@ TEST_CASE("read_code_point")
     }
 }
 
+TEST_CASE("decode_code_points")
+{
+    // 16 ASCII characters, followed by a multibyte code point
+    scn::string_view str{"abcdefghijklmnop\xc3\xa4\xe2\x82\xac" "q"};
+    auto input = scn::make_span(str.data(), str.size());
+
+    SUBCASE("span")
+    {
+        scn::code_point buf[32] = {};
+        auto ret = scn::decode_code_points(input, scn::make_span(buf, 32));
+        CHECK(ret);
+        CHECK(ret.value().chars.size() == str.size());
+        CHECK(ret.value().code_points.size() == 19);
+        CHECK(buf[0] == scn::make_code_point('a'));
+        CHECK(buf[15] == scn::make_code_point('p'));
+        CHECK(buf[16] == scn::make_code_point(0xe4));
+        CHECK(buf[17] == scn::make_code_point(0x20ac));
+        CHECK(buf[18] == scn::make_code_point('q'));
+    }
+    SUBCASE("short output")
+    {
+        scn::code_point buf[17] = {};
+        auto ret = scn::decode_code_points(input, scn::make_span(buf, 17));
+        CHECK(ret);
+        CHECK(ret.value().chars.size() == 18);
+        CHECK(ret.value().code_points.size() == 17);
+        CHECK(buf[16] == scn::make_code_point(0xe4));
+    }
+    SUBCASE("container")
+    {
+        scn::detail::small_vector<scn::code_point, 8> vec;
+        vec.push_back(scn::make_code_point('x'));
+        auto e = scn::decode_code_points(input, vec);
+        CHECK(e);
+        CHECK(vec.size() == 20);
+        CHECK(vec[0] == scn::make_code_point('x'));
+        CHECK(vec[17] == scn::make_code_point(0xe4));
+    }
+    SUBCASE("invalid")
+    {
+        scn::code_point buf[32] = {};
+        str = "abcdefghijk\xc3";
+        auto ret = scn::decode_code_points(
+            scn::make_span(str.data(), str.size()), scn::make_span(buf, 32));
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_encoding);
+
+        std::vector<scn::code_point> vec;
+        str = "abc\x81";
+        auto e = scn::decode_code_points(
+            scn::make_span(str.data(), str.size()), vec);
+        CHECK(!e);
+        CHECK(e == scn::error::invalid_encoding);
+        CHECK(vec.empty());
+    }
+}
+
+TEST_CASE("read_code_points")
+{
+    scn::code_point buf[8] = {};
+    auto bufspan = scn::make_span(buf, 8);
+
+    SUBCASE("contiguous")
+    {
+        auto range = scn::wrap(scn::string_view{"a\xc3\xa4\xe2\x82\xac"
+                                                "bcdefghij"});
+        auto ret = scn::read_code_points(range, bufspan);
+        CHECK(ret);
+        CHECK(ret.value().size() == 8);
+        CHECK(buf[1] == scn::make_code_point(0xe4));
+        CHECK(buf[2] == scn::make_code_point(0x20ac));
+        CHECK(buf[7] == scn::make_code_point('f'));
+
+        ret = scn::read_code_points(range, bufspan);
+        CHECK(ret);
+        CHECK(ret.value().size() == 4);
+        CHECK(buf[3] == scn::make_code_point('j'));
+        CHECK(range.empty());
+
+        ret = scn::read_code_points(range, bufspan);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::end_of_range);
+    }
+    SUBCASE("non-contiguous")
+    {
+        auto range = scn::wrap(get_deque<char>("a\xc3\xa4\xe2\x82\xac" "b"));
+        auto ret = scn::read_code_points(range, bufspan);
+        CHECK(ret);
+        CHECK(ret.value().size() == 4);
+        CHECK(buf[2] == scn::make_code_point(0x20ac));
+        CHECK(range.empty());
+    }
+    SUBCASE("invalid")
+    {
+        auto range = scn::wrap(scn::string_view{"ab\x81"});
+        auto ret = scn::read_code_points(range, bufspan);
+        CHECK(ret);
+        CHECK(ret.value().size() == 2);
+
+        ret = scn::read_code_points(range, bufspan);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_encoding);
+        CHECK(range.size() == 1);
+    }
+}
+
 TEST_CASE("invalid utf8")
 {
     scn::code_point cp{};